@@ -0,0 +1,386 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+// Throughput and allocation benchmarks, results are written to stdout as JSON.
+//
+//   smbios_bench [--min-time SECONDS] [--filter SUBSTRING] [DUMP...]
+//
+// Every DUMP is a `dmidecode --dump-bin` image benchmarked next to the
+// generated laptop, 2-socket, 8-socket and 10k-structure tables.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/basic_smbios_parser.hpp"
+#include "../src/bios_streambuf.hpp"
+#include "../src/smbios_archive.hpp"
+#include "../src/smbios_format.hpp"
+#include "../src/smbios_json.hpp"
+#include "../src/smbios_parser.hpp"
+#include "../generator/table_generator.hpp"
+
+// Every heap allocation of the process is counted, including the ones made by
+// the default memory resource.
+static std::atomic<std::size_t> allocation_count{0};
+static std::atomic<std::size_t> allocation_bytes{0};
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (auto p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+// std::pmr::new_delete_resource allocates through the aligned overloads.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  auto align = static_cast<std::size_t>(alignment);
+  if (auto p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+template<typename T>
+void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+struct bench_table {
+  std::string name;
+  std::vector<uint8_t> entry_point;
+  std::vector<uint8_t> table;
+};
+
+static bench_table make_table(std::string name, const table_generator_options& options) {
+  auto generated = generate_table(options);
+  return {std::move(name), std::move(generated.entry_point), std::move(generated.table)};
+}
+
+struct bench_result {
+  std::string name;
+  std::size_t iterations;
+  double ns_per_op;
+  double allocs_per_op;
+  double bytes_per_op;
+  // Items processed per iteration, e.g. structures for a parse, 0 when not meaningful.
+  std::size_t items;
+};
+
+// `s` as a JSON string. Names carry dump file names, so quotes, backslashes
+// and control characters are escaped.
+static void write_json_string(std::ostream& out, std::string_view s) {
+  static constexpr char digits[] = "0123456789abcdef";
+  out << '"';
+  for (char c : s) {
+    auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (byte < 0x20) {
+      out << "\\u00" << digits[byte >> 4] << digits[byte & 0xF];
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+struct bench_runner {
+  std::chrono::duration<double> min_time{0.2};
+  std::string filter;
+  std::vector<bench_result> results;
+
+  void run(const std::string& name, std::size_t items, const std::function<void()>& f) {
+    if (!filter.empty() && name.find(filter) == std::string::npos) {
+      return;
+    }
+    f();
+    std::size_t iterations = 1;
+    while (true) {
+      auto count = allocation_count.load(std::memory_order_relaxed);
+      auto bytes = allocation_bytes.load(std::memory_order_relaxed);
+      auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < iterations; ++i) {
+        f();
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (elapsed >= min_time || iterations >= (std::size_t{1} << 40)) {
+        auto n = static_cast<double>(iterations);
+        results.push_back({
+          name, iterations, elapsed.count() * 1e9 / n,
+          static_cast<double>(allocation_count.load(std::memory_order_relaxed) - count) / n,
+          static_cast<double>(allocation_bytes.load(std::memory_order_relaxed) - bytes) / n,
+          items,
+        });
+        return;
+      }
+      iterations *= 2;
+    }
+  }
+
+  void write_json(std::ostream& out) const {
+    out << "{\n  \"context\": {\n";
+#ifdef NDEBUG
+    out << "    \"build\": \"release\",\n";
+#else
+    out << "    \"build\": \"debug\",\n";
+#endif
+#ifdef SMBIOS_STRING_VIEW
+    out << "    \"string_view\": true,\n";
+#else
+    out << "    \"string_view\": false,\n";
+#endif
+    out << "    \"min_time_s\": " << min_time.count() << "\n  },\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto& r = results[i];
+      out << (i ? "," : "") << "\n    {\"name\": ";
+      write_json_string(out, r.name);
+      out << ", \"iterations\": " << r.iterations
+          << ", \"ns_per_op\": " << r.ns_per_op << ", \"allocs_per_op\": " << r.allocs_per_op
+          << ", \"bytes_per_op\": " << r.bytes_per_op;
+      // An op too fast to measure has no meaningful rate, and inf is not JSON.
+      if (r.items && r.ns_per_op > 0) {
+        out << ", \"items_per_second\": " << static_cast<double>(r.items) * 1e9 / r.ns_per_op;
+      }
+      out << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+static void bench_parser(bench_runner& runner, const bench_table& t) {
+  smbios_parser parsed;
+  parsed.parse(t.entry_point, t.table);
+  auto structures = parsed.structures.size();
+
+  runner.run("parse/" + t.name, structures, [&] {
+    smbios_parser parser;
+    parser.parse(t.entry_point, t.table);
+    keep(parser.structures.size());
+  });
+  // What an identity lookup costs when only system_info gets decoded.
+  runner.run("parse_lazy+sys_uuid/" + t.name, structures, [&] {
+    smbios_parser parser;
+    parser.lazy = true;
+    parser.parse(t.entry_point, t.table);
+    keep(parser.sys_uuid());
+  });
+  // Asset-inventory subset, the other types are only stepped over.
+  runner.run("parse_selected/" + t.name, structures, [&] {
+    smbios_parser parser;
+    parser.types = smbios_type_mask::of<bios_info, system_info, processor_info, memory_device>();
+    parser.parse(t.entry_point, t.table);
+    keep(parser.structures.size());
+  });
+  runner.run("parse_basic/" + t.name, structures, [&] {
+    basic_smbios_parser<bios_info, system_info> parser;
+    parser.parse(t.entry_point, t.table);
+    keep(parser.find<system_info>());
+  });
+  runner.run("reparse/" + t.name, structures, [&] {
+    parsed.parse(t.entry_point, t.table);
+    keep(parsed.structures.size());
+  });
+  // Structure boundaries only, the double-NUL scan that precedes every decode.
+  runner.run("scan/" + t.name, structures, [&] {
+    auto table = std::as_bytes(std::span(t.table));
+    std::size_t n = 0;
+    // Stops before end-of-table like smbios_parser, padding may follow it.
+    for (std::size_t offset = 0;
+         offset < table.size() && static_cast<smbios_type>(table[offset]) != smbios_type::end_of_table; ++n) {
+      offset += smbios_structure_size(table.subspan(offset));
+    }
+    keep(n);
+  });
+  runner.run("find/system_info/" + t.name, 0, [&] {
+    keep(parsed.find<system_info>());
+  });
+  runner.run("find/memory_device/" + t.name, 0, [&] {
+    keep(parsed.find<memory_device>());
+  });
+  runner.run("find/unknown_struct/" + t.name, 0, [&] {
+    keep(parsed.find<unknown_struct>());
+  });
+  runner.run("find_all/memory_device/" + t.name, 0, [&] {
+    std::size_t n = 0;
+    for (const auto& dimm : parsed.find_all<memory_device>()) {
+      n += dimm.speed;
+    }
+    keep(n);
+  });
+  runner.run("sys_uuid/" + t.name, 0, [&] {
+    keep(parsed.sys_uuid());
+  });
+  if (auto sys = parsed.find<system_info>()) {
+    runner.run("format_uuid/" + t.name, 0, [&] {
+      char text[uuid_chars];
+      keep(format_uuid(text, text + uuid_chars, sys->uuid, parsed.version).ptr - text);
+    });
+  }
+  if (auto unknown = parsed.find<unknown_struct>()) {
+    runner.run("format_hex/" + t.name, unknown->data.size(), [&] {
+      char text[hex_chars(255, ' ')];
+      auto data = std::span(unknown->data).first(std::min<std::size_t>(unknown->data.size(), 255));
+      keep(format_hex(text, text + sizeof(text), data, ' ').ptr - text);
+    });
+  }
+  // Into a string that keeps its capacity, so only the formatting is measured.
+  std::string json;
+  runner.run("write_ndjson/" + t.name, structures, [&] {
+    json.clear();
+    smbios_json_writer writer(json);
+    writer.write_ndjson(parsed);
+    keep(json.size());
+  });
+  std::vector<uint8_t> archive;
+  runner.run("write_archive/" + t.name, structures, [&] {
+    archive.clear();
+    write_smbios_archive(parsed, archive);
+    keep(archive.size());
+  });
+  // Opening checks every record, then system_info is read in place.
+  runner.run("archive_view+uuid/" + t.name, structures, [&] {
+    smbios_archive_view view(std::as_bytes(std::span(archive)));
+    for (auto sys : view.of_type(smbios_type::system_information)) {
+      keep(sys.field<uint64_t>(8));
+    }
+  });
+  runner.run("sys_product_name/" + t.name, 0, [&] {
+    keep(parsed.sys_product_name());
+  });
+  if (auto unknown = parsed.find<unknown_struct>()) {
+    runner.run("unknown_struct::to_strings/" + t.name, 0, [&] {
+      keep(unknown->to_strings());
+    });
+  }
+}
+
+static void bench_streambuf(bench_runner& runner, const bench_table& t) {
+  auto table = t.table;
+  auto begin = table.data();
+  auto end = table.data() + table.size();
+  auto words = [&](std::size_t size) {
+    return table.size() / size;
+  };
+
+  runner.run("bios_streambuf/read_uint8", words(1), [&] {
+    bios_streambuf buf(begin, end);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, n = words(1); i < n; ++i) {
+      sum += buf.read_uint8();
+    }
+    keep(sum);
+  });
+  runner.run("bios_streambuf/read_uint16", words(2), [&] {
+    bios_streambuf buf(begin, end);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, n = words(2); i < n; ++i) {
+      sum += buf.read_uint16();
+    }
+    keep(sum);
+  });
+  runner.run("bios_streambuf/read_uint32", words(4), [&] {
+    bios_streambuf buf(begin, end);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, n = words(4); i < n; ++i) {
+      sum += buf.read_uint32();
+    }
+    keep(sum);
+  });
+  runner.run("bios_streambuf/read_uint64", words(8), [&] {
+    bios_streambuf buf(begin, end);
+    uint64_t sum = 0;
+    for (std::size_t i = 0, n = words(8); i < n; ++i) {
+      sum += buf.read_uint64();
+    }
+    keep(sum);
+  });
+  // bios_info's vendor string, resolved through the string set.
+  runner.run("bios_streambuf/read_string", 0, [&] {
+    bios_streambuf buf(begin, end);
+    buf.header_start();
+    buf.pubseekoff(4, std::ios_base::beg);
+    keep(buf.read_string(table[1]));
+  });
+}
+
+int main(int argc, char* argv[]) {
+  bench_runner runner;
+  std::vector<bench_table> tables;
+  tables.push_back(make_table("laptop", {.version = 0x0302, .processors = 1, .memory_devices = 2, .slots = 2,
+                                         .ports = 6, .onboard_devices = 1, .oem_structures = 12}));
+  tables.push_back(make_table("server_2s", {.processors = 2, .memory_devices = 32, .slots = 8, .ports = 6,
+                                            .onboard_devices = 4, .firmware_components = 8, .oem_structures = 40}));
+  tables.push_back(make_table("server_8s", {.processors = 8, .memory_devices = 96, .slots = 16, .ports = 6,
+                                            .onboard_devices = 8, .firmware_components = 16, .oem_structures = 64}));
+  tables.push_back(make_table("synthetic_10k", {.memory_devices = 1024, .string_length = 32, .total_structures = 10000}));
+
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    if (arg == "--min-time" && i + 1 < argc) {
+      runner.min_time = std::chrono::duration<double>(std::strtod(argv[++i], nullptr));
+    } else if (arg == "--filter" && i + 1 < argc) {
+      runner.filter = argv[++i];
+    } else if (arg.starts_with("--")) {
+      std::cerr << "usage: " << argv[0] << " [--min-time SECONDS] [--filter SUBSTRING] [DUMP...]\n";
+      return 2;
+    } else {
+      // Captured dump, benchmarked from its raw blobs like the built-in tables.
+      table_buffer entry_point;
+      table_buffer table;
+      try {
+        dump_file_source(std::string(arg)).load(entry_point, table);
+      } catch (const std::exception& e) {
+        std::cerr << "what: " << e.what() << "\n";
+        return 1;
+      }
+      tables.push_back({
+        std::filesystem::path(arg).filename().string(),
+        {entry_point.data(), entry_point.data() + entry_point.size()},
+        {table.data(), table.data() + table.size()},
+      });
+    }
+  }
+
+  for (const auto& table : tables) {
+    bench_parser(runner, table);
+  }
+  bench_streambuf(runner, tables.back());
+  runner.write_json(std::cout);
+  return 0;
+}
@@ -0,0 +1,110 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+// Writes a synthetic SMBIOS table, either as a sysfs-style directory or as a
+// `dmidecode --dump-bin` image.
+
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+#include "table_generator.hpp"
+
+static void usage(const char* name) {
+  std::cerr << "usage: " << name << " [options] (--sysfs DIR | --dump FILE)\n"
+               "  --version MAJOR.MINOR      SMBIOS version, default 3.3\n"
+               "  --processors N             default 2\n"
+               "  --memory-devices N         default 16\n"
+               "  --slots N                  default 4\n"
+               "  --ports N                  default 4\n"
+               "  --onboard-devices N        default 2\n"
+               "  --firmware-components N    default 2\n"
+               "  --oem N                    OEM structures, default 4\n"
+               "  --string-length N          pad strings to N characters\n"
+               "  --structures N             pad the table with OEM structures to N\n";
+}
+
+static bool parse_number(std::string_view text, uint32_t& value) {
+  auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+  return ec == std::errc() && end == text.data() + text.size();
+}
+
+static bool parse_version(std::string_view text, uint32_t& version) {
+  auto dot = text.find('.');
+  uint32_t major;
+  uint32_t minor;
+  if (dot == std::string_view::npos || !parse_number(text.substr(0, dot), major) ||
+      !parse_number(text.substr(dot + 1), minor) || major > 0xFF || minor > 0xFF) {
+    return false;
+  }
+  version = major << 8 | minor;
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  table_generator_options options;
+  const char* sysfs = nullptr;
+  const char* dump = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+      return 2;
+    }
+    std::string_view value = argv[++i];
+    bool ok = true;
+    if (arg == "--sysfs") {
+      sysfs = value.data();
+    } else if (arg == "--dump") {
+      dump = value.data();
+    } else if (arg == "--version") {
+      ok = parse_version(value, options.version);
+    } else if (arg == "--processors") {
+      ok = parse_number(value, options.processors);
+    } else if (arg == "--memory-devices") {
+      ok = parse_number(value, options.memory_devices);
+    } else if (arg == "--slots") {
+      ok = parse_number(value, options.slots);
+    } else if (arg == "--ports") {
+      ok = parse_number(value, options.ports);
+    } else if (arg == "--onboard-devices") {
+      ok = parse_number(value, options.onboard_devices);
+    } else if (arg == "--firmware-components") {
+      ok = parse_number(value, options.firmware_components);
+    } else if (arg == "--oem") {
+      ok = parse_number(value, options.oem_structures);
+    } else if (arg == "--string-length") {
+      ok = parse_number(value, options.string_length);
+    } else if (arg == "--structures") {
+      ok = parse_number(value, options.total_structures);
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      std::cerr << "invalid argument: " << arg << " " << value << "\n";
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (!sysfs && !dump) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  try {
+    auto generated = generate_table(options);
+    if (sysfs) {
+      write_sysfs_tables(generated, sysfs);
+    }
+    if (dump) {
+      write_dump(generated, dump);
+    }
+    std::cerr << generated.structure_count << " structures, " << generated.table.size() << " bytes\n";
+  } catch (const std::exception& e) {
+    std::cerr << "what: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
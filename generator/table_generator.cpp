@@ -0,0 +1,680 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "table_generator.hpp"
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../src/smbios.hpp"
+
+// Appends little-endian fields to a byte vector.
+class byte_writer {
+protected:
+  std::vector<uint8_t>& out;
+
+public:
+  explicit byte_writer(std::vector<uint8_t>& out) : out(out) {
+  }
+
+  void u8(uint64_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+  }
+
+  void u16(uint64_t value) {
+    u8(value);
+    u8(value >> 8);
+  }
+
+  void u32(uint64_t value) {
+    u16(value);
+    u16(value >> 16);
+  }
+
+  void u64(uint64_t value) {
+    u32(value);
+    u32(value >> 32);
+  }
+
+  void bytes(std::size_t count, uint8_t value) {
+    out.insert(out.end(), count, value);
+  }
+
+  void chars(std::string_view s) {
+    out.insert(out.end(), s.begin(), s.end());
+  }
+};
+
+// Appends one structure: the header, the formatted fields in order and the
+// string set collected by str() and add_string().
+class structure_writer : public byte_writer {
+  std::size_t start;
+  std::vector<std::string> strings;
+
+public:
+  structure_writer(std::vector<uint8_t>& out, smbios_type type, uint16_t handle) : byte_writer(out), start(out.size()) {
+    u8(static_cast<uint8_t>(type));
+    u8(0);
+    u16(handle);
+  }
+
+  // Writes the 1-based index of `s` in the string set.
+  void str(std::string s) {
+    add_string(std::move(s));
+    u8(strings.size());
+  }
+
+  // Adds `s` to the string set without referencing it, for count-prefixed lists.
+  void add_string(std::string s) {
+    strings.push_back(std::move(s));
+  }
+
+  void finish() {
+    auto length = out.size() - start;
+    if (length > 0xFF) {
+      throw std::runtime_error(std::format("formatted area of type {} is {} bytes", out[start], length));
+    }
+    out[start + 1] = static_cast<uint8_t>(length);
+    for (const auto& s : strings) {
+      out.insert(out.end(), s.begin(), s.end());
+      out.push_back(0);
+    }
+    if (strings.empty()) {
+      out.push_back(0);
+    }
+    out.push_back(0);
+  }
+};
+
+class table_generator {
+  const table_generator_options& options;
+  std::vector<uint8_t> table;
+  uint32_t count = 0;
+
+  [[nodiscard]] bool since(smbios_version version) const {
+    return options.version >= static_cast<uint32_t>(version);
+  }
+
+  // `base` followed by `index`, padded with a repeating pattern to string_length.
+  [[nodiscard]] std::string text(std::string_view base, uint32_t index) const {
+    auto s = std::format("{} {}", base, index);
+    for (std::size_t i = 0; s.size() < options.string_length; ++i) {
+      s.push_back("0123456789ABCDEF"[i % 16]);
+    }
+    return s;
+  }
+
+  structure_writer begin(smbios_type type, uint16_t& handle) {
+    if (count >= 0xFEFF) {
+      throw std::runtime_error("generated table exceeds the 0xFEFF structure handles");
+    }
+    handle = static_cast<uint16_t>(count++);
+    return {table, type, handle};
+  }
+
+  uint16_t bios() {
+    uint16_t handle;
+    auto w = begin(smbios_type::bios_information, handle);
+    w.str(text("Synthetic Firmware Inc.", 0));
+    w.str(text("1.0", options.version));
+    w.u16(0xE800);
+    w.str("01/01/2026");
+    w.u8(0xFF);
+    w.u64(0x0B9A);
+    if (options.version == 0x0201 || options.version == 0x0202) {
+      w.u8(0x03);
+    } else if (since(smbios_version::smbios_2_3)) {
+      w.u8(0x03);
+      w.u8(0x0D);
+    }
+    if (since(smbios_version::smbios_2_4)) {
+      w.u8(1);
+      w.u8(options.version & 0xFF);
+      w.u8(1);
+      w.u8(0);
+    }
+    if (since(smbios_version::smbios_3_1)) {
+      w.u16(0x20);
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t system() {
+    uint16_t handle;
+    auto w = begin(smbios_type::system_information, handle);
+    w.str(text("Synthetic Systems", 0));
+    w.str(text("Generated Server", options.processors));
+    w.str(text("Version", 1));
+    w.str(text("SN", 0x5EED));
+    if (since(smbios_version::smbios_2_1)) {
+      for (uint32_t i = 0; i < 16; ++i) {
+        w.u8(0x10 + i);
+      }
+      w.u8(6);
+    }
+    if (since(smbios_version::smbios_2_4)) {
+      w.str(text("SKU", 0));
+      w.str(text("Family", 0));
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t enclosure() {
+    uint16_t handle;
+    auto w = begin(smbios_type::system_enclosure, handle);
+    w.str(text("Synthetic Systems", 0));
+    w.u8(0x17);
+    w.str(text("Chassis", 1));
+    w.str(text("CSN", 0));
+    w.str(text("Asset", 0));
+    if (since(smbios_version::smbios_2_1)) {
+      w.bytes(4, 3);
+    }
+    if (since(smbios_version::smbios_2_3)) {
+      w.u32(0);
+      w.u8(2);
+      w.u8(2);
+      // One contained element record: type, minimum and maximum count.
+      w.u8(1);
+      w.u8(3);
+      w.u8(0x02);
+      w.u8(1);
+      w.u8(1);
+    }
+    if (since(smbios_version::smbios_2_7)) {
+      w.str(text("Chassis SKU", 0));
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t cache(uint32_t level, uint32_t kb) {
+    uint16_t handle;
+    auto w = begin(smbios_type::cache_information, handle);
+    w.str(text("L" + std::to_string(level) + " Cache", handle));
+    w.u16(0x180 | (level - 1));
+    auto size16 = kb < 0x8000 ? kb : 0x8000 | (kb / 64);
+    w.u16(size16);
+    w.u16(size16);
+    w.u16(0x20);
+    w.u16(0x20);
+    if (since(smbios_version::smbios_2_1)) {
+      w.u8(0);
+      w.u8(6);
+      w.u8(level == 1 ? 4 : 5);
+      w.u8(6 + level);
+    }
+    if (since(smbios_version::smbios_3_1)) {
+      w.u32(kb);
+      w.u32(kb);
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t processor(uint32_t index) {
+    uint16_t l1 = cache(1, 48 * 32);
+    uint16_t l2 = cache(2, 1280 * 32);
+    uint16_t l3 = cache(3, 48 * 1024);
+    uint16_t handle;
+    auto w = begin(smbios_type::processor_information, handle);
+    w.str(text("CPU", index));
+    w.u8(3);
+    w.u8(0xB3);
+    w.str(text("Synthetic Silicon", 0));
+    w.u64(0xBFEBFBFF000606A6);
+    w.str(text("Synthetic(R) Processor @ 2.30GHz", index));
+    w.u8(0x8B);
+    w.u16(100);
+    w.u16(4000);
+    w.u16(2300);
+    w.u8(0x41);
+    w.u8(0x3D);
+    if (since(smbios_version::smbios_2_1)) {
+      w.u16(l1);
+      w.u16(l2);
+      w.u16(l3);
+    }
+    if (since(smbios_version::smbios_2_3)) {
+      w.str(text("CPU SN", index));
+      w.str(text("CPU Asset", index));
+      w.str(text("CPU PN", index));
+    }
+    if (since(smbios_version::smbios_2_5)) {
+      w.u8(32);
+      w.u8(32);
+      w.u8(64);
+      w.u16(0xFC);
+    }
+    if (since(smbios_version::smbios_2_6)) {
+      w.u16(0xB3);
+      w.u16(32);
+      w.u16(32);
+      w.u16(64);
+    }
+    w.finish();
+    return handle;
+  }
+
+  void baseboard(uint16_t chassis, const std::vector<uint16_t>& contained) {
+    uint16_t handle;
+    auto w = begin(smbios_type::baseboard_information, handle);
+    w.str(text("Synthetic Systems", 0));
+    w.str(text("Board", 0));
+    w.str(text("A00", 0));
+    w.str(text("BSN", 0));
+    w.str(text("Board Asset", 0));
+    w.u8(0x09);
+    w.str(text("Board Location", 0));
+    w.u16(chassis);
+    w.u8(0x0A);
+    auto n = contained.size() < 16 ? contained.size() : 16;
+    w.u8(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      w.u16(contained[i]);
+    }
+    w.finish();
+  }
+
+  void port(uint32_t index) {
+    uint16_t handle;
+    auto w = begin(smbios_type::port_connector_information, handle);
+    w.str(text("J", index));
+    w.u8(0);
+    w.str(text("USB", index));
+    w.u8(0x12);
+    w.u8(0x10);
+    w.finish();
+  }
+
+  void slot(uint32_t index) {
+    uint16_t handle;
+    auto w = begin(smbios_type::system_slots, handle);
+    w.str(text("PCIe Slot", index));
+    w.u8(0xAA);
+    w.u8(0x0D);
+    w.u8(3);
+    w.u8(4);
+    w.u16(index);
+    w.u8(0x04);
+    if (since(smbios_version::smbios_2_1)) {
+      w.u8(0x03);
+    }
+    if (since(smbios_version::smbios_2_6)) {
+      w.u16(0);
+      w.u8(0x17 + index);
+      w.u8(0);
+    }
+    if (since(smbios_version::smbios_3_2)) {
+      w.u8(0x0D);
+      // One peer: segment, bus, device/function and width.
+      w.u8(1);
+      w.u16(0);
+      w.u8(0x18 + index);
+      w.u8(0);
+      w.u8(0x0D);
+    }
+    if (since(smbios_version::smbios_3_4)) {
+      w.u8(0x04);
+      w.u8(0x0D);
+      w.u16(2000);
+      w.u8(1);
+    }
+    w.finish();
+  }
+
+  void string_list(smbios_type type, std::string_view base, uint32_t n) {
+    uint16_t handle;
+    auto w = begin(type, handle);
+    w.u8(n);
+    for (uint32_t i = 0; i < n; ++i) {
+      w.add_string(text(base, i));
+    }
+    w.finish();
+  }
+
+  uint16_t memory_array(uint32_t devices) {
+    uint16_t handle;
+    auto w = begin(smbios_type::physical_memory_array, handle);
+    w.u8(3);
+    w.u8(3);
+    w.u8(6);
+    w.u32(0x80000000);
+    w.u16(0xFFFE);
+    w.u16(devices);
+    if (since(smbios_version::smbios_2_7)) {
+      w.u64(uint64_t{devices} << 36);
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t memory_device(uint16_t array, uint32_t index) {
+    uint16_t handle;
+    auto w = begin(smbios_type::memory_device, handle);
+    w.u16(array);
+    w.u16(0xFFFE);
+    w.u16(72);
+    w.u16(64);
+    w.u16(0x7FFF);
+    w.u8(9);
+    w.u8(0);
+    w.str(text("DIMM", index));
+    w.str(text("BANK", index / 2));
+    w.u8(0x1A);
+    w.u16(0x2080);
+    if (since(smbios_version::smbios_2_3)) {
+      w.u16(3200);
+      w.str(text("Synthetic Memory", 0));
+      w.str(text("DSN", index));
+      w.str(text("DIMM Asset", index));
+      w.str(text("DIMM-PN-3200", 0));
+    }
+    if (since(smbios_version::smbios_2_6)) {
+      w.u8(2);
+    }
+    if (since(smbios_version::smbios_2_7)) {
+      w.u32(65536);
+      w.u16(3200);
+    }
+    if (since(smbios_version::smbios_2_8)) {
+      w.u16(1200);
+      w.u16(1200);
+      w.u16(1200);
+    }
+    if (since(smbios_version::smbios_3_2)) {
+      w.u8(3);
+      w.u16(0x08);
+      w.str(text("FW", 1));
+      w.u16(0x2C80);
+      w.u16(0);
+      w.u16(0);
+      w.u16(0);
+      w.u64(0);
+      w.u64(uint64_t{1} << 36);
+      w.u64(0);
+      w.u64(0);
+    }
+    if (since(smbios_version::smbios_3_3)) {
+      w.u32(3200);
+      w.u32(3200);
+    }
+    w.finish();
+    return handle;
+  }
+
+  uint16_t array_mapped(uint16_t array) {
+    uint16_t handle;
+    auto w = begin(smbios_type::memory_array_mapped_address, handle);
+    w.u32(0);
+    w.u32(0xFFFFFFFF);
+    w.u16(array);
+    w.u8(4);
+    if (since(smbios_version::smbios_2_7)) {
+      w.u64(0);
+      w.u64(0);
+    }
+    w.finish();
+    return handle;
+  }
+
+  void device_mapped(uint16_t device, uint16_t mapped, uint32_t index) {
+    uint16_t handle;
+    auto w = begin(smbios_type::memory_device_mapped_address, handle);
+    w.u32(index * 0x400000);
+    w.u32(index * 0x400000 + 0x3FFFFF);
+    w.u16(device);
+    w.u16(mapped);
+    w.u8(1);
+    w.u8(1);
+    w.u8(1);
+    if (since(smbios_version::smbios_2_7)) {
+      w.u64(0);
+      w.u64(0);
+    }
+    w.finish();
+  }
+
+  void memory_error() {
+    uint16_t handle;
+    auto w = begin(smbios_type::memory_error_information_32, handle);
+    w.u8(3);
+    w.u8(2);
+    w.u8(2);
+    w.u32(0);
+    w.u32(0x80000000);
+    w.u32(0x80000000);
+    w.u32(0x80000000);
+    w.finish();
+  }
+
+  void boot() {
+    uint16_t handle;
+    auto w = begin(smbios_type::system_boot_information, handle);
+    w.bytes(6, 0);
+    w.bytes(10, 0);
+    w.finish();
+  }
+
+  void additional(uint16_t referenced) {
+    uint16_t handle;
+    auto w = begin(smbios_type::additional_information, handle);
+    w.u8(2);
+    for (uint32_t i = 0; i < 2; ++i) {
+      // Length, referenced handle and offset, string and a 2-byte value.
+      w.u8(7);
+      w.u16(referenced);
+      w.u8(4 + i);
+      w.str(text("Additional", i));
+      w.u16(i);
+    }
+    w.finish();
+  }
+
+  void onboard(uint32_t index) {
+    uint16_t handle;
+    auto w = begin(smbios_type::onboard_devices_extended_info, handle);
+    w.str(text("Embedded NIC", index));
+    w.u8(0x85);
+    w.u8(index);
+    w.u16(0);
+    w.u8(0x20 + index);
+    w.u8(0);
+    w.finish();
+  }
+
+  void tpm() {
+    uint16_t handle;
+    auto w = begin(smbios_type::tpm_device, handle);
+    w.chars("SYNT");
+    w.u8(2);
+    w.u8(0);
+    w.u32(0x10002);
+    w.u32(0x30004);
+    w.str(text("TPM 2.0", 0));
+    w.u64(0x18);
+    w.u32(0xDEAD);
+    w.finish();
+  }
+
+  void processor_additional(uint16_t processor) {
+    uint16_t handle;
+    auto w = begin(smbios_type::processor_additional_information, handle);
+    w.u16(processor);
+    w.u8(8);
+    w.u8(7);
+    w.u64(0x0102030405060708);
+    w.finish();
+  }
+
+  void firmware(uint32_t index, uint16_t first, uint16_t last) {
+    uint16_t handle;
+    auto w = begin(smbios_type::firmware_inventory_information, handle);
+    w.str(text("Firmware", index));
+    w.str(text("1.0", index));
+    w.u8(1);
+    w.str(text("FWID", index));
+    w.u8(0);
+    w.str("2026-01-01");
+    w.str(text("Synthetic Firmware Inc.", 0));
+    w.str(text("0.9", 0));
+    w.u64(16 << 20);
+    w.u16(1);
+    w.u8(3);
+    w.u8(2);
+    w.u16(first);
+    w.u16(last);
+    w.finish();
+  }
+
+  void oem(uint32_t index) {
+    uint16_t handle;
+    auto w = begin(static_cast<smbios_type>(0x80 + index % 0x7F), handle);
+    w.bytes(4 + index % 24, static_cast<uint8_t>(index));
+    w.str(text("OEM record", index));
+    w.str(text("oem.example", 0));
+    w.finish();
+  }
+
+  void end() {
+    uint16_t handle;
+    auto w = begin(smbios_type::end_of_table, handle);
+    w.finish();
+  }
+
+  [[nodiscard]] std::vector<uint8_t> entry_point() const {
+    auto major = static_cast<uint8_t>(options.version >> 8);
+    auto minor = static_cast<uint8_t>(options.version);
+    std::vector<uint8_t> ep;
+    byte_writer w(ep);
+    if (options.version >= static_cast<uint32_t>(smbios_version::smbios_3_0)) {
+      w.chars("_SM3_");
+      w.u8(0);
+      w.u8(0x18);
+      w.u8(major);
+      w.u8(minor);
+      w.u8(0);
+      w.u8(1);
+      w.u8(0);
+      w.u32(table.size());
+      w.u64(0x20);
+      ep[5] = checksum(ep, 0, ep.size());
+    } else {
+      if (table.size() > 0xFFFF) {
+        throw std::runtime_error(std::format("{} byte table does not fit a 2.x entry point", table.size()));
+      }
+      w.chars("_SM_");
+      w.u8(0);
+      w.u8(0x1F);
+      w.u8(major);
+      w.u8(minor);
+      w.u16(0xFF);
+      w.u8(0);
+      w.bytes(5, 0);
+      w.chars("_DMI_");
+      w.u8(0);
+      w.u16(table.size());
+      w.u32(0x20);
+      w.u16(count);
+      w.u8((major << 4) | (minor & 0x0F));
+      ep[0x15] = checksum(ep, 0x10, ep.size());
+      ep[4] = checksum(ep, 0, ep.size());
+    }
+    return ep;
+  }
+
+  static uint8_t checksum(const std::vector<uint8_t>& bytes, std::size_t begin, std::size_t end) {
+    uint8_t sum = 0;
+    for (auto i = begin; i < end; ++i) {
+      sum += bytes[i];
+    }
+    return static_cast<uint8_t>(-sum);
+  }
+
+public:
+  explicit table_generator(const table_generator_options& options) : options(options) {
+  }
+
+  generated_table generate() {
+    bios();
+    system();
+    auto chassis = enclosure();
+    std::vector<uint16_t> processors;
+    for (uint32_t i = 0; i < options.processors; ++i) {
+      processors.push_back(processor(i));
+    }
+    baseboard(chassis, processors);
+    for (uint32_t i = 0; i < options.ports; ++i) {
+      port(i);
+    }
+    for (uint32_t i = 0; i < options.slots; ++i) {
+      slot(i);
+    }
+    string_list(smbios_type::oem_strings, "OEM string", 3);
+    string_list(smbios_type::system_configuration_options, "Option", 1);
+    auto array = memory_array(options.memory_devices);
+    std::vector<uint16_t> devices;
+    for (uint32_t i = 0; i < options.memory_devices; ++i) {
+      devices.push_back(memory_device(array, i));
+    }
+    auto mapped = array_mapped(array);
+    for (uint32_t i = 0; i < devices.size(); ++i) {
+      device_mapped(devices[i], mapped, i);
+    }
+    memory_error();
+    boot();
+    additional(chassis);
+    for (uint32_t i = 0; i < options.onboard_devices; ++i) {
+      onboard(i);
+    }
+    tpm();
+    for (auto p : processors) {
+      processor_additional(p);
+    }
+    for (uint32_t i = 0; i < options.firmware_components; ++i) {
+      firmware(i, devices.empty() ? 0xFFFF : devices.front(), devices.empty() ? 0xFFFF : devices.back());
+    }
+    for (uint32_t i = 0; i < options.oem_structures; ++i) {
+      oem(i);
+    }
+    for (uint32_t i = options.oem_structures; count + 1 < options.total_structures; ++i) {
+      oem(i);
+    }
+    end();
+    return {entry_point(), std::move(table), count};
+  }
+};
+
+generated_table generate_table(const table_generator_options& options) {
+  return table_generator(options).generate();
+}
+
+static void write_file(const std::filesystem::path& path, const std::vector<uint8_t>& head,
+                       const std::vector<uint8_t>& tail) {
+  std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+  if (!file) {
+    throw std::runtime_error(std::format("can not open {}", path.string()));
+  }
+  file.write(reinterpret_cast<const char*>(head.data()), static_cast<std::streamsize>(head.size()));
+  file.write(reinterpret_cast<const char*>(tail.data()), static_cast<std::streamsize>(tail.size()));
+  if (!file) {
+    throw std::runtime_error(std::format("can not write {}", path.string()));
+  }
+}
+
+void write_sysfs_tables(const generated_table& generated, const std::filesystem::path& directory) {
+  std::filesystem::create_directories(directory);
+  write_file(directory / "smbios_entry_point", generated.entry_point, {});
+  write_file(directory / "DMI", generated.table, {});
+}
+
+void write_dump(const generated_table& generated, const std::filesystem::path& path) {
+  auto head = generated.entry_point;
+  head.resize(0x20, 0);
+  write_file(path, head, generated.table);
+}
@@ -0,0 +1,50 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_TABLE_GENERATOR_HPP
+#define SMBIOS_TABLE_GENERATOR_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+// Shape of a synthetic table. Every structure type the parser decodes is
+// emitted at least once, the counts scale the repeated ones.
+struct table_generator_options {
+  // major << 8 | minor, picks the entry point kind (_SM_ below 3.0) and which
+  // version-dependent fields are written.
+  uint32_t version = 0x0303;
+  uint32_t processors = 2;
+  uint32_t memory_devices = 16;
+  uint32_t slots = 4;
+  uint32_t ports = 4;
+  uint32_t onboard_devices = 2;
+  uint32_t firmware_components = 2;
+  uint32_t oem_structures = 4;
+  // Strings are padded to at least this many characters, 0 keeps them short.
+  uint32_t string_length = 0;
+  // Appends OEM structures until the table holds this many, 0 for none.
+  uint32_t total_structures = 0;
+};
+
+struct generated_table {
+  // Its table address is 0x20, where write_dump places the table.
+  std::vector<uint8_t> entry_point;
+  // Structures including the end-of-table structure.
+  std::vector<uint8_t> table;
+  uint32_t structure_count = 0;
+};
+
+// Throws std::runtime_error when the table outgrows the handle space or, for
+// versions below 3.0, the 16-bit table length of the 32-bit entry point.
+generated_table generate_table(const table_generator_options& options);
+
+// smbios_entry_point and DMI files in `directory`, readable by sysfs_source.
+void write_sysfs_tables(const generated_table& generated, const std::filesystem::path& directory);
+
+// `dmidecode --dump-bin` image, readable by smbios_parser::parse_file.
+void write_dump(const generated_table& generated, const std::filesystem::path& path);
+
+
+#endif //SMBIOS_TABLE_GENERATOR_HPP
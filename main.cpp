@@ -1,14 +1,109 @@
+#include <charconv>
+#include <cstring>
 #include <iostream>
+#include <string_view>
+#include "src/smbios_batch.hpp"
+#include "src/smbios_format.hpp"
+#include "src/smbios_json.hpp"
 #include "src/smbios_parser.hpp"
 
-int main() {
+// One tab-separated line per dump: path, version, structure count, product
+// name and UUID, or path and the error.
+static void write_summary(const batch_record& record, std::string& out) {
+  out += record.path.string();
+  if (!record.error.empty()) {
+    out += "\terror\t";
+    out += record.error;
+  } else {
+    const auto& parser = record.parser;
+    out += '\t';
+    out += std::to_string(parser.version >> 8) + '.' + std::to_string(parser.version & 0xFF);
+    out += '\t';
+    out += std::to_string(parser.structures.size());
+    out += '\t';
+    out += parser.sys_product_name();
+    out += '\t';
+    if (auto sys = parser.find<system_info>()) {
+      char uuid[uuid_chars];
+      out.append(uuid, format_uuid(uuid, uuid + uuid_chars, sys->uuid, parser.version).ptr);
+    }
+  }
+  out += '\n';
+}
+
+static int run_batch(const char* directory, const batch_options& options) {
+  try {
+    auto files = batch_files(directory);
+    auto result = parse_batch(files, write_summary, std::cout, options);
+    std::cerr << result.files << " files, " << result.failed << " failed\n";
+    return result.failed ? 1 : 0;
+  } catch (const std::exception& e) {
+    std::cerr << "what: " << e.what() << "\n";
+    return 1;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const char* batch = nullptr;
+  const char* path = nullptr;
+  const char* cache = nullptr;
+  bool json = false;
+  bool ndjson = false;
+  batch_options options;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+      batch = argv[++i];
+    } else if (std::strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+      cache = argv[++i];
+    } else if (std::strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (std::strcmp(argv[i], "--ndjson") == 0) {
+      ndjson = true;
+    } else if (std::strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+      std::string_view value = argv[++i];
+      auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), options.jobs);
+      if (ec != std::errc() || end != value.data() + value.size()) {
+        std::cerr << "usage: " << argv[0] << " [--cache FILE] [--json | --ndjson] [DUMP | --batch DIR [--jobs N]]\n";
+        return 2;
+      }
+    } else {
+      path = argv[i];
+    }
+  }
+  if (batch) {
+    return run_batch(batch, options);
+  }
+
   smbios_parser parser;
+  if (cache) {
+    parser.cache_path = cache;
+  }
   try {
-    parser.parse();
+    if (path) {
+      parser.parse_file(path);
+    } else {
+      parser.parse();
+    }
   } catch (const std::exception& e) {
     std::cerr << "what: " << e.what() << "\n";
   }
 
+  if (json || ndjson) {
+    try {
+      smbios_json_writer writer(1);
+      if (json) {
+        writer.write_json(parser);
+      } else {
+        writer.write_ndjson(parser);
+      }
+      writer.flush();
+    } catch (const std::exception& e) {
+      std::cerr << "what: " << e.what() << "\n";
+      return 1;
+    }
+    return 0;
+  }
+
   auto info = parser.find<bios_info>();
   if (info) {
     std::cout << info->vendor << '\n';
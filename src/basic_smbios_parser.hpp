@@ -0,0 +1,185 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_BASIC_SMBIOS_PARSER_HPP
+#define SMBIOS_BASIC_SMBIOS_PARSER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "smbios.hpp"
+#include "smbios_parser.hpp"
+#include "smbios_source.hpp"
+#include "table_buffer.hpp"
+
+// Parser that knows only the structure classes in Ts, e.g.
+// basic_smbios_parser<system_info, bios_info>. Dispatch is resolved at
+// compile time and only the decoders of Ts are referenced, so linking with
+// --gc-sections drops the others. Structures of any other type are stepped
+// over without allocating.
+template<typename... Ts> requires ((std::is_base_of_v<smbios, Ts> && requires { Ts::TYPE; }) && ...)
+class basic_smbios_parser : public smbios_decode_context {
+  static constexpr std::array<smbios_type, sizeof...(Ts)> types{Ts::TYPE...};
+
+  static_assert([] {
+    for (std::size_t i = 0; i < types.size(); ++i) {
+      if (std::ranges::find(types, types[i]) - types.begin() != static_cast<std::ptrdiff_t>(i)) {
+        return false;
+      }
+    }
+    return true;
+  }(), "two structure classes share the same TYPE");
+
+  // Position of `type` in Ts, sizeof...(Ts) when it is not there.
+  static constexpr std::size_t index_of(smbios_type type) {
+    return std::ranges::find(types, type) - types.begin();
+  }
+
+  // Each class in its own vector, in table order.
+  std::tuple<std::pmr::vector<Ts>...> structures;
+  // Structures of Ts found by the pre-scan, decoded once every vector is sized.
+  std::pmr::vector<structure_bounds> bounds;
+
+  void decode(std::span<const std::byte> entry_point_bytes) {
+    entry_point = read_entry_point(entry_point_bytes);
+    version = entry_point ? std::min(entry_point->version(), static_cast<uint32_t>(smbios_version::smbios_3_5)) : 0;
+
+    // Sized up front, so no structure is copied by a vector growing.
+    auto bytes = table.bytes();
+    std::array<std::size_t, sizeof...(Ts)> counts{};
+    std::exception_ptr scan_error;
+    try {
+      std::size_t offset = 0;
+      while (offset < bytes.size() && static_cast<smbios_type>(bytes[offset]) != smbios_type::end_of_table) {
+        auto size = smbios_structure_size(bytes.subspan(offset));
+        auto index = index_of(static_cast<smbios_type>(bytes[offset]));
+        if (index < sizeof...(Ts)) {
+          bounds.push_back({offset, size});
+          ++counts[index];
+        }
+        offset += size;
+      }
+    } catch (...) {
+      scan_error = std::current_exception();
+    }
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (std::get<Is>(structures).reserve(counts[Is]), ...);
+    }(std::index_sequence_for<Ts...>{});
+
+    for (const auto& b : bounds) {
+      bios_reader reader(bytes.subspan(b.offset, b.size));
+      auto type = static_cast<smbios_type>(bytes[b.offset]);
+      ((type == Ts::TYPE && (decode_as<Ts>(reader), true)) || ...);
+    }
+    if (scan_error) {
+      std::rethrow_exception(scan_error);
+    }
+  }
+
+  template<typename T>
+  void decode_as(bios_reader& reader) {
+    smbios_read(std::get<std::pmr::vector<T>>(structures).emplace_back(resource()), reader, this);
+  }
+
+public:
+  std::unique_ptr<smbios_entry_point> entry_point;
+  // Raw table the structures were decoded from, smbios_string views point into it.
+  table_buffer table;
+
+  // Structures and their strings and vectors allocate from `resource`, which
+  // must outlive the parser.
+  explicit basic_smbios_parser(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+    structures(std::pmr::vector<Ts>(resource)...),
+    bounds(resource) {
+  }
+
+  // Live tables: the sysfs entries of Ts on Linux, the whole sysfs table
+  // where they are not exported, GetSystemFirmwareTable on Windows.
+  void parse() {
+#ifdef WIN32
+    firmware_table_source source;
+#else
+    sysfs_entries_source entries(smbios_type_mask::of<Ts...>());
+    if (std::filesystem::is_directory(entries.directory)) {
+      parse(entries);
+      return;
+    }
+    sysfs_source source;
+#endif
+    parse(source);
+  }
+
+  // Replaces anything parsed before with the tables `source` supplies. On a
+  // malformed table the structures before the bad one are kept and
+  // std::runtime_error is thrown.
+  void parse(smbios_source& source) {
+    clear();
+    table_buffer entry_buf;
+    source.load(entry_buf, table);
+    decode(entry_buf.bytes());
+  }
+
+  // Raw entry point and table blobs, copied so neither has to outlive the call.
+  void parse(std::span<const uint8_t> entry_point_bytes, std::span<const uint8_t> table_bytes) {
+    memory_source source(entry_point_bytes, table_bytes);
+    parse(source);
+  }
+
+  // `dmidecode --dump-bin` image.
+  void parse_file(const std::string& path) {
+    dump_file_source source(path);
+    parse(source);
+  }
+
+  // Drops every structure and the retained table.
+  void clear() {
+    version = 0;
+    entry_point.reset();
+    std::apply([](auto&... all) { (all.clear(), ...); }, structures);
+    bounds.clear();
+    table.clear();
+  }
+
+  template<typename T> requires (std::is_same_v<T, Ts> || ...)
+  const T* find() const {
+    const auto& all = std::get<std::pmr::vector<T>>(structures);
+    return all.empty() ? nullptr : &all.front();
+  }
+
+  // Every structure of type T in table order.
+  template<typename T> requires (std::is_same_v<T, Ts> || ...)
+  std::span<const T> find_all() const {
+    return std::get<std::pmr::vector<T>>(structures);
+  }
+
+  // Calls f with each structure as its concrete type, type by type in the
+  // order of Ts and in table order within a type.
+  template<typename F>
+  void visit(F&& f) const {
+    std::apply([&](const auto&... all) {
+      (std::ranges::for_each(all, f), ...);
+    }, structures);
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    return std::apply([](const auto&... all) { return (all.size() + ... + 0); }, structures);
+  }
+
+  [[nodiscard]] std::pmr::memory_resource* resource() const {
+    return bounds.get_allocator().resource();
+  }
+};
+
+
+#endif //SMBIOS_BASIC_SMBIOS_PARSER_HPP
@@ -0,0 +1,123 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "bios_reader.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define SMBIOS_SSE2
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// Compiled for AVX2 regardless of -march and picked at run time.
+#define SMBIOS_AVX2
+#endif
+#endif
+
+using terminator_finder = std::size_t (*)(const std::byte* data, std::size_t size, std::size_t from);
+
+// memchr for each NUL, then a look at the byte after it.
+static std::size_t find_terminator_scalar(const std::byte* data, std::size_t size, std::size_t from) {
+  while (from + 1 < size) {
+    auto nul = static_cast<const std::byte*>(std::memchr(data + from, 0, size - from - 1));
+    if (!nul) {
+      break;
+    }
+    auto i = static_cast<std::size_t>(nul - data);
+    if (data[i + 1] == std::byte{0}) {
+      return i;
+    }
+    from = i + 2;
+  }
+  return size;
+}
+
+#ifdef SMBIOS_SSE2
+
+// Compares 16 bytes and the 16 after them by one against zero, a set bit in
+// both marks a pair.
+static std::size_t find_terminator_sse2(const std::byte* data, std::size_t size, std::size_t from) {
+  auto zero = _mm_setzero_si128();
+  for (; from + 17 <= size; from += 16) {
+    auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + from));
+    auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + from + 1));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, zero), _mm_cmpeq_epi8(b, zero))));
+    if (mask) {
+      return from + std::countr_zero(mask);
+    }
+  }
+  return find_terminator_scalar(data, size, from);
+}
+
+#endif
+
+#ifdef SMBIOS_AVX2
+
+__attribute__((target("avx2")))
+static std::size_t find_terminator_avx2(const std::byte* data, std::size_t size, std::size_t from) {
+  auto zero = _mm256_setzero_si256();
+  for (; from + 33 <= size; from += 32) {
+    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + from));
+    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + from + 1));
+    auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, zero), _mm256_cmpeq_epi8(b, zero))));
+    if (mask) {
+      return from + std::countr_zero(mask);
+    }
+  }
+  return find_terminator_sse2(data, size, from);
+}
+
+#endif
+
+static terminator_finder select_terminator_finder() {
+#ifdef SMBIOS_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    return find_terminator_avx2;
+  }
+#endif
+#ifdef SMBIOS_SSE2
+  return find_terminator_sse2;
+#else
+  return find_terminator_scalar;
+#endif
+}
+
+std::size_t bios_find_terminator(std::span<const std::byte> buffer, std::size_t from) {
+  static const terminator_finder find = select_terminator_finder();
+  return from < buffer.size() ? find(buffer.data(), buffer.size(), from) : buffer.size();
+}
+
+bios_string_table::bios_string_table(std::span<const std::byte> set) {
+  assign(set);
+}
+
+void bios_string_table::assign(std::span<const std::byte> new_set) {
+  set = new_set;
+  count = 0;
+  auto begin = reinterpret_cast<const char*>(set.data());
+  std::size_t pos = 0;
+  while (pos < set.size() && count < max_strings) {
+    offsets[count++] = static_cast<uint32_t>(pos);
+    auto nul = static_cast<const char*>(std::memchr(begin + pos, '\0', set.size() - pos));
+    pos = nul ? nul - begin + 1 : set.size() + 1;
+  }
+  offsets[count] = static_cast<uint32_t>(pos);
+}
+
+void bios_reader::read_bytes(void* dst, std::size_t count) {
+  auto n = count < remaining() ? count : remaining();
+  std::memcpy(dst, buffer.data() + position, n);
+  std::memset(static_cast<std::byte*>(dst) + n, 0, count - n);
+  position += n;
+}
+
+std::string_view bios_reader::read_string() {
+  auto index = read_uint8();
+  return string_table ? (*string_table)[index] : std::string_view();
+}
+
+void bios_reader::read_strings(std::pmr::vector<smbios_string>& strings) {
+  auto count = read_uint8();
+  for (std::size_t index = 1; index <= count && string_table; ++index) {
+    strings.emplace_back((*string_table)[index]);
+  }
+}
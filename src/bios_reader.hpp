@@ -0,0 +1,176 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_BIOS_READER_HPP
+#define SMBIOS_BIOS_READER_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Text fields are views into the DMI table retained by smbios_parser when
+// built with SMBIOS_STRING_VIEW, owning strings otherwise. Views stay valid
+// for as long as the parser that produced them. Owning strings allocate from
+// the parser's memory resource.
+#ifdef SMBIOS_STRING_VIEW
+struct smbios_string : std::string_view {
+  using std::string_view::basic_string_view;
+
+  smbios_string() = default;
+
+  smbios_string(std::string_view view) noexcept : std::string_view(view) {
+  }
+
+  // Views never allocate, accepted so fields are declared alike in both modes.
+  explicit smbios_string(std::pmr::memory_resource*) noexcept {
+  }
+};
+#else
+using smbios_string = std::pmr::string;
+#endif
+
+// Unaligned little-endian load, SMBIOS stores every multi-byte field LE.
+template<typename T> requires std::is_integral_v<T>
+T bios_load_le(const std::byte* src) {
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+    value = std::byteswap(value);
+  }
+  return value;
+}
+
+// Returns the position of the double-NUL that ends the string set starting at
+// `from`, or buffer.size() when the set is not terminated. Uses AVX2 or SSE2
+// where the CPU has them.
+std::size_t bios_find_terminator(std::span<const std::byte> buffer, std::size_t from);
+
+// Offsets of every string in a structure's string set, found in one pass so
+// string indices resolve in constant time.
+class bios_string_table {
+public:
+  static constexpr std::size_t max_strings = 255;
+
+private:
+  std::span<const std::byte> set;
+  std::size_t count = 0;
+  std::array<uint32_t, max_strings + 1> offsets;
+
+public:
+  bios_string_table() = default;
+
+  // `set` spans the string set without its double-NUL terminator.
+  explicit bios_string_table(std::span<const std::byte> set);
+
+  void assign(std::span<const std::byte> new_set);
+
+  [[nodiscard]] std::size_t size() const {
+    return count;
+  }
+
+  [[nodiscard]] std::span<const std::byte> bytes() const {
+    return set;
+  }
+
+  // 1-based like the string fields themselves, 0 or a missing index is empty.
+  [[nodiscard]] std::string_view operator[](std::size_t index) const {
+    if (index == 0 || index > count) {
+      return {};
+    }
+    return {reinterpret_cast<const char*>(set.data()) + offsets[index - 1], offsets[index] - offsets[index - 1] - 1};
+  }
+};
+
+// Bounds-checked cursor over a span of raw table bytes. A read that does not
+// fit in the remaining bytes yields zero and moves the cursor to the end, so
+// fields missing from a shorter structure decode as absent.
+class bios_reader {
+  std::span<const std::byte> buffer;
+  std::size_t position = 0;
+  const bios_string_table* string_table = nullptr;
+
+public:
+  explicit bios_reader(std::span<const std::byte> buffer, const bios_string_table* strings = nullptr) :
+    buffer(buffer),
+    string_table(strings) {
+  }
+
+  [[nodiscard]] std::size_t pos() const {
+    return position;
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    return buffer.size();
+  }
+
+  [[nodiscard]] std::size_t remaining() const {
+    return buffer.size() - position;
+  }
+
+  [[nodiscard]] const std::byte* data() const {
+    return buffer.data() + position;
+  }
+
+  void seek(std::size_t new_pos) {
+    position = new_pos < buffer.size() ? new_pos : buffer.size();
+  }
+
+  void skip(std::size_t count) {
+    seek(position + count);
+  }
+
+  template<typename T> requires std::is_integral_v<T>
+  T read() {
+    if (remaining() < sizeof(T)) {
+      position = buffer.size();
+      return 0;
+    }
+    T value = bios_load_le<T>(buffer.data() + position);
+    position += sizeof(T);
+    return value;
+  }
+
+  uint8_t read_uint8() {
+    return read<uint8_t>();
+  }
+
+  uint16_t read_uint16() {
+    return read<uint16_t>();
+  }
+
+  uint32_t read_uint32() {
+    return read<uint32_t>();
+  }
+
+  uint64_t read_uint64() {
+    return read<uint64_t>();
+  }
+
+  [[nodiscard]] uint8_t peek_uint8() const {
+    return position < buffer.size() ? static_cast<uint8_t>(buffer[position]) : 0;
+  }
+
+  [[nodiscard]] const bios_string_table* strings() const {
+    return string_table;
+  }
+
+  void read_bytes(void* dst, std::size_t count);
+
+  std::string_view read_string();
+
+  // Appends the strings named by a count byte followed by string indices
+  // 1..count, allocating from `strings`' memory resource.
+  void read_strings(std::pmr::vector<smbios_string>& strings);
+};
+
+
+#endif //SMBIOS_BIOS_READER_HPP
@@ -3,6 +3,7 @@
 //
 
 #include "bios_streambuf.hpp"
+#include "bios_reader.hpp"
 #include <istream>
 #include <string>
 
@@ -73,28 +74,25 @@ void bios_streambuf::seek_offset() {
   offset = 0;
 }
 
+template<typename T>
+T bios_streambuf::read_le() {
+  std::byte bytes[sizeof(T)]{};
+  sgetn(reinterpret_cast<char*>(bytes), sizeof(T));
+  return bios_load_le<T>(bytes);
+}
+
 uint8_t bios_streambuf::read_uint8() {
   return sbumpc();
 }
 
 uint16_t bios_streambuf::read_uint16() {
-  return sbumpc() | sbumpc() << 8;
+  return read_le<uint16_t>();
 }
 
 uint32_t bios_streambuf::read_uint32() {
-  return static_cast<uint32_t>(sbumpc()) |
-         static_cast<uint32_t>(sbumpc() << 8) |
-         static_cast<uint32_t>(sbumpc() << 16) |
-         static_cast<uint32_t>(sbumpc() << 24);
+  return read_le<uint32_t>();
 }
 
 uint64_t bios_streambuf::read_uint64() {
-  return (static_cast<uint64_t>(sbumpc()) << 0) |
-         (static_cast<uint64_t>(sbumpc()) << 8) |
-         (static_cast<uint64_t>(sbumpc()) << 16) |
-         (static_cast<uint64_t>(sbumpc()) << 24) |
-         (static_cast<uint64_t>(sbumpc()) << 32) |
-         (static_cast<uint64_t>(sbumpc()) << 40) |
-         (static_cast<uint64_t>(sbumpc()) << 48) |
-         (static_cast<uint64_t>(sbumpc()) << 56);
+  return read_le<uint64_t>();
 }
@@ -10,9 +10,15 @@
 #include <streambuf>
 #include <vector>
 
+// Compatibility shim for code written against the old stream-based decoder.
+// The structure decoders read through bios_reader instead.
 class bios_streambuf : public std::streambuf {
   int offset = 0;
   size_t header_start_pos = 0;
+
+  template<typename T>
+  T read_le();
+
 public:
 
   bios_streambuf(uint8_t* beg, uint8_t* end);
@@ -0,0 +1,43 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "handle_map.hpp"
+#include "smbios.hpp"
+
+void handle_map::build(std::span<smbios* const> structures) {
+  uint32_t bits = 1;
+  while ((std::size_t{1} << bits) < structures.size() * 2) {
+    ++bits;
+  }
+  shift = 32 - bits;
+  slots.assign(std::size_t{1} << bits, slot{});
+  auto mask = slots.size() - 1;
+  for (smbios* structure : structures) {
+    auto i = home(structure->header.handle);
+    while (slots[i].structure && slots[i].handle != structure->header.handle) {
+      i = (i + 1) & mask;
+    }
+    if (!slots[i].structure) {
+      slots[i] = {structure, structure->header.handle};
+    }
+  }
+}
+
+void handle_map::clear() {
+  slots.clear();
+  shift = 32;
+}
+
+smbios* handle_map::find(uint16_t handle) const {
+  if (slots.empty()) {
+    return nullptr;
+  }
+  auto mask = slots.size() - 1;
+  for (auto i = home(handle); slots[i].structure; i = (i + 1) & mask) {
+    if (slots[i].handle == handle) {
+      return slots[i].structure;
+    }
+  }
+  return nullptr;
+}
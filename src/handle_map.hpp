@@ -0,0 +1,44 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_HANDLE_MAP_HPP
+#define SMBIOS_HANDLE_MAP_HPP
+
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+struct smbios;
+
+// Flat open-addressing map from structure handle to structure. The slot count
+// is a power of two at least twice the number of structures, collisions are
+// probed linearly. When handles repeat the first structure in table order wins.
+class handle_map {
+  struct slot {
+    smbios* structure = nullptr;
+    uint16_t handle = 0;
+  };
+
+  std::pmr::vector<slot> slots;
+  uint32_t shift = 32;
+
+  [[nodiscard]] std::size_t home(uint16_t handle) const {
+    return static_cast<uint32_t>(handle * 2654435769u) >> shift;
+  }
+
+public:
+  // The slots allocate from `resource`.
+  explicit handle_map(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : slots(resource) {
+  }
+
+  void build(std::span<smbios* const> structures);
+
+  void clear();
+
+  [[nodiscard]] smbios* find(uint16_t handle) const;
+};
+
+
+#endif //SMBIOS_HANDLE_MAP_HPP
@@ -7,8 +7,6 @@
 #include <format>
 #include <iomanip>
 
-#include "smbios_parser.hpp"
-
 #ifdef WIN32
 
 #include <windows.h>
@@ -19,40 +17,55 @@
 #include <fstream>
 #endif
 
-void smbios_header::read(bios_streambuf& istream) {
-  type = static_cast<smbios_type>(istream.sbumpc());
-  length = istream.sbumpc();
-  handle = istream.sbumpc() | istream.sbumpc() << 8;
-}
-
-void smbios_entry_point32::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  istream.sgetn(reinterpret_cast<char*>(anchor_string), sizeof(anchor_string));
-  entry_point_structure_checksum = istream.sbumpc();
-  entry_point_length = istream.sbumpc();
-  smbios_major_version = istream.sbumpc();
-  smbios_minor_version = istream.sbumpc();
-  max_structure_size = istream.sbumpc();
-  entry_point_revision = istream.sbumpc();
-  istream.sgetn(reinterpret_cast<char*>(formatted_area), sizeof(formatted_area));
-  istream.sgetn(reinterpret_cast<char*>(intermediate_anchor_string), sizeof(intermediate_anchor_string));
-  intermediate_checksum = istream.sbumpc();
-  structure_table_length = istream.read_uint16();
-  structure_table_addr = istream.read_uint32();
-  num_of_smbios_structures = istream.read_uint16();
-  smbios_bcd_revision = istream.sbumpc();
-}
-
-void smbios_entry_point64::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  istream.sgetn(reinterpret_cast<char*>(anchor_string), sizeof(anchor_string));
-  entry_point_structure_checksum = istream.sbumpc();
-  entry_point_length = istream.sbumpc();
-  smbios_major_version = istream.sbumpc();
-  smbios_minor_version = istream.sbumpc();
-  smbios_docrev = istream.sbumpc();
-  entry_point_revision = istream.sbumpc();
-  reserved = istream.sbumpc();
-  structure_table_max_size = istream.read_uint32();
-  structure_table_addr = istream.read_uint64();
+void smbios_header::read(bios_reader& reader) {
+  type = static_cast<smbios_type>(reader.read_uint8());
+  length = reader.read_uint8();
+  handle = reader.read_uint16();
+}
+
+void smbios_entry_point32::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_bytes(anchor_string, sizeof(anchor_string));
+  entry_point_structure_checksum = reader.read_uint8();
+  entry_point_length = reader.read_uint8();
+  smbios_major_version = reader.read_uint8();
+  smbios_minor_version = reader.read_uint8();
+  max_structure_size = reader.read_uint16();
+  entry_point_revision = reader.read_uint8();
+  reader.read_bytes(formatted_area, sizeof(formatted_area));
+  reader.read_bytes(intermediate_anchor_string, sizeof(intermediate_anchor_string));
+  intermediate_checksum = reader.read_uint8();
+  structure_table_length = reader.read_uint16();
+  structure_table_addr = reader.read_uint32();
+  num_of_smbios_structures = reader.read_uint16();
+  smbios_bcd_revision = reader.read_uint8();
+}
+
+void smbios_entry_point64::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_bytes(anchor_string, sizeof(anchor_string));
+  entry_point_structure_checksum = reader.read_uint8();
+  entry_point_length = reader.read_uint8();
+  smbios_major_version = reader.read_uint8();
+  smbios_minor_version = reader.read_uint8();
+  smbios_docrev = reader.read_uint8();
+  entry_point_revision = reader.read_uint8();
+  reserved = reader.read_uint8();
+  structure_table_max_size = reader.read_uint32();
+  structure_table_addr = reader.read_uint64();
+}
+
+std::unique_ptr<smbios_entry_point> read_entry_point(std::span<const std::byte> bytes) {
+  std::string_view anchor(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  std::unique_ptr<smbios_entry_point> entry_point;
+  if (anchor.starts_with("_SM_")) {
+    entry_point = std::make_unique<smbios_entry_point32>();
+  } else if (anchor.starts_with("_SM3_")) {
+    entry_point = std::make_unique<smbios_entry_point64>();
+  } else {
+    return nullptr;
+  }
+  bios_reader reader(bytes);
+  entry_point->read_params(reader, nullptr);
+  return entry_point;
 }
 
 bios_characteristics operator|(const bios_characteristics& lhs, const bios_characteristics& rhs) {
@@ -95,40 +108,64 @@ extended_bios_rom_size operator&(const extended_bios_rom_size& lhs, const extend
   return static_cast<extended_bios_rom_size>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void smbios::read(bios_streambuf& istream, smbios_parser* parser) {
-  istream.header_start();
-  header.read(istream);
-  read_params(istream, parser);
-  istream.seek_offset();
-  char end[2];
-  if (istream.sgetn(end, 2) != 2 || end[0] != 0 || end[1] != 0) {
-    throw std::runtime_error(std::format("structure terminator not found, type: {}", static_cast<int>(header.type)));
+// Position of the double-NUL ending the structure at the start of `table`.
+static std::size_t structure_end(std::span<const std::byte> table) {
+  auto type = table.empty() ? 0 : static_cast<int>(table[0]);
+  auto length = table.size() < 2 ? 0 : static_cast<std::size_t>(table[1]);
+  if (length < 4 || table.size() < length) {
+    throw std::runtime_error(std::format("invalid structure length, type: {}", type));
+  }
+  auto end = bios_find_terminator(table, length);
+  if (end == table.size()) {
+    throw std::runtime_error(std::format("structure terminator not found, type: {}", type));
   }
+  return end;
+}
+
+std::size_t smbios_structure_size(std::span<const std::byte> table) {
+  return structure_end(table) + 2;
 }
 
-void bios_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
+smbios_structure::smbios_structure(bios_reader& reader) {
+  auto start = reader.pos();
+  std::span table(reader.data(), reader.remaining());
+  auto end = structure_end(table);
+  header.read(reader);
+  formatted = table.subspan(4, header.length - 4);
+  strings.assign(table.subspan(header.length, end - header.length));
+  reader.seek(start + end + 2);
+}
+
+void smbios::read(bios_reader& reader, smbios_decode_context* parser) {
+  smbios_structure structure(reader);
+  header = structure.header;
+  auto formatted = structure.formatted_reader();
+  read_params(formatted, parser);
+}
+
+void bios_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    vendor = istream.read_string(header.length);
-    bios_version = istream.read_string(header.length);
-    bios_starting_addr_seg = istream.read_uint16();
-    bios_release_date = istream.read_string(header.length);
-    bios_rom_size = istream.sbumpc();
-    bios_characteristics = static_cast<enum bios_characteristics>(istream.read_uint64());
+    vendor = reader.read_string();
+    bios_version = reader.read_string();
+    bios_starting_addr_seg = reader.read_uint16();
+    bios_release_date = reader.read_string();
+    bios_rom_size = reader.read_uint8();
+    bios_characteristics = static_cast<enum bios_characteristics>(reader.read_uint64());
   }
   if (parser->version == smbios_version::smbios_2_1 || parser->version == smbios_version::smbios_2_2) {
-    bios_characteristics_ext_byte1 = static_cast<bios_char_ext_byte1>(istream.sbumpc());
+    bios_characteristics_ext_byte1 = static_cast<bios_char_ext_byte1>(reader.read_uint8());
   } else if (parser->version >= smbios_version::smbios_2_3) {
-    bios_characteristics_ext_byte1 = static_cast<bios_char_ext_byte1>(istream.sbumpc());
-    bios_characteristics_ext_byte2 = static_cast<bios_char_ext_byte2>(istream.sbumpc());
+    bios_characteristics_ext_byte1 = static_cast<bios_char_ext_byte1>(reader.read_uint8());
+    bios_characteristics_ext_byte2 = static_cast<bios_char_ext_byte2>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_2_4) {
-    system_bios_major_release = istream.sbumpc();
-    system_bios_minor_release = istream.sbumpc();
-    embedded_controller_firmware_major_release = istream.sbumpc();
-    embedded_controller_firmware_minor_release = istream.sbumpc();
+    system_bios_major_release = reader.read_uint8();
+    system_bios_minor_release = reader.read_uint8();
+    embedded_controller_firmware_major_release = reader.read_uint8();
+    embedded_controller_firmware_minor_release = reader.read_uint8();
   }
   if (parser->version >= smbios_version::smbios_3_1) {
-    extended_bios_rom_size = static_cast<enum extended_bios_rom_size>(istream.read_uint16());
+    extended_bios_rom_size = static_cast<enum extended_bios_rom_size>(reader.read_uint16());
   }
 }
 
@@ -158,20 +195,20 @@ wake_up_type operator&(const wake_up_type& lhs, const wake_up_type& rhs) {
   return static_cast<wake_up_type>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void system_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void system_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    manufacturer = istream.read_string(header.length);
-    product_name = istream.read_string(header.length);
-    version = istream.read_string(header.length);
-    serial_number = istream.read_string(header.length);
+    manufacturer = reader.read_string();
+    product_name = reader.read_string();
+    version = reader.read_string();
+    serial_number = reader.read_string();
   }
   if (parser->version >= smbios_version::smbios_2_1) {
-    istream.sgetn(reinterpret_cast<char*>(uuid), sizeof(uuid));
-    wake_up_type = static_cast<enum wake_up_type>(istream.sbumpc());
+    reader.read_bytes(uuid, sizeof(uuid));
+    wake_up_type = static_cast<enum wake_up_type>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_2_4) {
-    sku_number = istream.read_string(header.length);
-    family = istream.read_string(header.length);
+    sku_number = reader.read_string();
+    family = reader.read_string();
   }
 }
 
@@ -185,19 +222,19 @@ feature_flag operator&(const feature_flag& lhs, const feature_flag& rhs) {
   return static_cast<feature_flag>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void baseboard_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  manufacturer = istream.read_string(header.length);
-  product = istream.read_string(header.length);
-  version = istream.read_string(header.length);
-  serial_number = istream.read_string(header.length);
-  asset_tag = istream.read_string(header.length);
-  feature_flags = static_cast<feature_flag>(istream.sbumpc());
-  location_in_chassis = istream.read_string(header.length);
-  chassis_handle = istream.read_uint16();
-  board_type = static_cast<enum board_type>(istream.sbumpc());
-  num_of_contained_object_handles = istream.sbumpc();
+void baseboard_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  manufacturer = reader.read_string();
+  product = reader.read_string();
+  version = reader.read_string();
+  serial_number = reader.read_string();
+  asset_tag = reader.read_string();
+  feature_flags = static_cast<feature_flag>(reader.read_uint8());
+  location_in_chassis = reader.read_string();
+  chassis_handle = reader.read_uint16();
+  board_type = static_cast<enum board_type>(reader.read_uint8());
+  num_of_contained_object_handles = reader.read_uint8();
   for (int i = 0; i < num_of_contained_object_handles; ++i) {
-    contained_object_handles.push_back(istream.read_uint16());
+    contained_object_handles.push_back(reader.read_uint16());
   }
 }
 
@@ -211,32 +248,32 @@ chassis_type operator&(const chassis_type& lhs, const chassis_type& rhs) {
   return static_cast<chassis_type>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void system_enclosure::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void system_enclosure::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    manufacturer = istream.read_string(header.length);
-    type = static_cast<chassis_type>(istream.sbumpc());
-    version = istream.read_string(header.length);
-    serial_number = istream.read_string(header.length);
-    asset_tag_number = istream.read_string(header.length);
+    manufacturer = reader.read_string();
+    type = static_cast<chassis_type>(reader.read_uint8());
+    version = reader.read_string();
+    serial_number = reader.read_string();
+    asset_tag_number = reader.read_string();
   }
   if (parser->version >= smbios_version::smbios_2_1) {
-    boot_up_state = static_cast<system_enclosure_state>(istream.sbumpc());
-    power_supply_state = static_cast<system_enclosure_state>(istream.sbumpc());
-    thermal_state = static_cast<system_enclosure_state>(istream.sbumpc());
-    security_status = static_cast<system_enclosure_state>(istream.sbumpc());
+    boot_up_state = static_cast<system_enclosure_state>(reader.read_uint8());
+    power_supply_state = static_cast<system_enclosure_state>(reader.read_uint8());
+    thermal_state = static_cast<system_enclosure_state>(reader.read_uint8());
+    security_status = static_cast<system_enclosure_state>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_2_3) {
-    oem_defined = istream.read_uint32();
-    height = istream.sbumpc();
-    num_of_power_cords = istream.sbumpc();
-    contained_element_count = istream.sbumpc();
-    contained_element_record_length = istream.sbumpc();
+    oem_defined = reader.read_uint32();
+    height = reader.read_uint8();
+    num_of_power_cords = reader.read_uint8();
+    contained_element_count = reader.read_uint8();
+    contained_element_record_length = reader.read_uint8();
     for (int i = 0; i < contained_element_count * contained_element_record_length; ++i) {
-      contained_elements.push_back(istream.sbumpc());
+      contained_elements.push_back(reader.read_uint8());
     }
   }
   if (parser->version >= smbios_version::smbios_2_7) {
-    sku_number = istream.read_string(header.length);
+    sku_number = reader.read_string();
   }
 }
 
@@ -257,42 +294,42 @@ cpu_status& cpu_status::operator=(uint8_t new_value) {
   return *this;
 }
 
-void processor_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void processor_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    socket_designation = istream.read_string(header.length);
-    processor_type = static_cast<enum processor_type>(istream.sbumpc());
-    processor_family = static_cast<enum processor_family>(istream.sbumpc());
-    processor_manufacturer = istream.read_string(header.length);
-    processor_id = istream.read_uint64();
-    processor_version = istream.read_string(header.length);
-    voltage = istream.sbumpc();
-    external_clock = istream.read_uint16();
-    max_speed = istream.read_uint16();
-    current_speed = istream.read_uint16();
-    status = istream.sbumpc();
-    processor_upgrade = static_cast<enum processor_upgrade>(istream.sbumpc());
+    socket_designation = reader.read_string();
+    processor_type = static_cast<enum processor_type>(reader.read_uint8());
+    processor_family = static_cast<enum processor_family>(reader.read_uint8());
+    processor_manufacturer = reader.read_string();
+    processor_id = reader.read_uint64();
+    processor_version = reader.read_string();
+    voltage = reader.read_uint8();
+    external_clock = reader.read_uint16();
+    max_speed = reader.read_uint16();
+    current_speed = reader.read_uint16();
+    status = reader.read_uint8();
+    processor_upgrade = static_cast<enum processor_upgrade>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_2_1) {
-    l1_cache_handle = istream.read_uint16();
-    l2_cache_handle = istream.read_uint16();
-    l3_cache_handle = istream.read_uint16();
+    l1_cache_handle = reader.read_uint16();
+    l2_cache_handle = reader.read_uint16();
+    l3_cache_handle = reader.read_uint16();
   }
   if (parser->version >= smbios_version::smbios_2_3) {
-    serial_number = istream.read_string(header.length);
-    asset_tag = istream.read_string(header.length);
-    part_number = istream.read_string(header.length);
+    serial_number = reader.read_string();
+    asset_tag = reader.read_string();
+    part_number = reader.read_string();
   }
   if (parser->version >= smbios_version::smbios_2_5) {
-    core_count = istream.sbumpc();
-    core_enabled = istream.sbumpc();
-    thread_count = istream.sbumpc();
-    processor_characteristics = static_cast<enum processor_characteristics>(istream.read_uint16());
+    core_count = reader.read_uint8();
+    core_enabled = reader.read_uint8();
+    thread_count = reader.read_uint8();
+    processor_characteristics = static_cast<enum processor_characteristics>(reader.read_uint16());
   }
   if (parser->version >= smbios_version::smbios_2_6) {
-    processor_family_2 = static_cast<enum processor_family>(istream.read_uint16());
-    core_count_2 = istream.read_uint16();
-    core_enabled_2 = istream.read_uint16();
-    thread_count_2 = istream.read_uint16();
+    processor_family_2 = static_cast<enum processor_family>(reader.read_uint16());
+    core_count_2 = reader.read_uint16();
+    core_enabled_2 = reader.read_uint16();
+    thread_count_2 = reader.read_uint16();
   }
 }
 
@@ -334,96 +371,96 @@ cache_size2& cache_size2::operator=(uint32_t new_value) {
   return *this;
 }
 
-void cache_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void cache_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    socket_designation = istream.read_string(header.length);
-    cache_configuration = istream.read_uint16();
-    max_cache_size = istream.read_uint16();
-    installed_size = istream.read_uint16();
-    supported_sram_type = static_cast<sram_type>(istream.read_uint16());
-    current_sram_type = static_cast<sram_type>(istream.read_uint16());
+    socket_designation = reader.read_string();
+    cache_configuration = reader.read_uint16();
+    max_cache_size = reader.read_uint16();
+    installed_size = reader.read_uint16();
+    supported_sram_type = static_cast<sram_type>(reader.read_uint16());
+    current_sram_type = static_cast<sram_type>(reader.read_uint16());
   }
   if (parser->version >= smbios_version::smbios_2_1) {
-    cache_speed = istream.sbumpc();
-    error_correction_type = static_cast<enum error_correction_type>(istream.sbumpc());
-    system_cache_type = static_cast<enum system_cache_type>(istream.sbumpc());
-    associativity = static_cast<enum associativity>(istream.sbumpc());
+    cache_speed = reader.read_uint8();
+    error_correction_type = static_cast<enum error_correction_type>(reader.read_uint8());
+    system_cache_type = static_cast<enum system_cache_type>(reader.read_uint8());
+    associativity = static_cast<enum associativity>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_3_1) {
-    max_cache_size2 = istream.read_uint32();
-    installed_cache_size2 = istream.read_uint32();
+    max_cache_size2 = reader.read_uint32();
+    installed_cache_size2 = reader.read_uint32();
   }
 }
 
-void port_connector_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  internal_ref_designator = istream.read_string(header.length);
-  internal_connector_type = static_cast<connector_type>(istream.sbumpc());
-  external_ref_designator = istream.read_string(header.length);
-  external_connector_type = static_cast<connector_type>(istream.sbumpc());
-  port_type = static_cast<enum port_type>(istream.sbumpc());
+void port_connector_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  internal_ref_designator = reader.read_string();
+  internal_connector_type = static_cast<connector_type>(reader.read_uint8());
+  external_ref_designator = reader.read_string();
+  external_connector_type = static_cast<connector_type>(reader.read_uint8());
+  port_type = static_cast<enum port_type>(reader.read_uint8());
 }
 
-void oem_strings::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  strings = istream.read_strings(header.length);
+void oem_strings::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_strings(strings);
 }
 
-void system_configuration_options::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  strings = istream.read_strings(header.length);
+void system_configuration_options::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_strings(strings);
 }
 
-void physical_memory_array::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void physical_memory_array::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_1) {
-    location = static_cast<memory_array_location>(istream.sbumpc());
-    use = static_cast<memory_array_use>(istream.sbumpc());
-    memory_error_correction = static_cast<memory_array_error_correction>(istream.sbumpc());
-    max_capacity = istream.read_uint32();
-    memory_err_info_handle = istream.read_uint16();
-    num_of_memory_device = istream.read_uint16();
+    location = static_cast<memory_array_location>(reader.read_uint8());
+    use = static_cast<memory_array_use>(reader.read_uint8());
+    memory_error_correction = static_cast<memory_array_error_correction>(reader.read_uint8());
+    max_capacity = reader.read_uint32();
+    memory_err_info_handle = reader.read_uint16();
+    num_of_memory_device = reader.read_uint16();
   }
   if (parser->version >= smbios_version::smbios_2_7) {
-    extended_max_capacity = istream.read_uint64();
+    extended_max_capacity = reader.read_uint64();
   }
 }
 
-void memory_error_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void memory_error_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_1) {
-    error_type = static_cast<memory_error_type>(istream.sbumpc());
-    error_granularity = static_cast<memory_error_granularity>(istream.sbumpc());
-    error_operation = static_cast<memory_error_operation>(istream.sbumpc());
-    vendor_syndrome = istream.read_uint32();
-    memory_array_error_address = istream.read_uint32();
-    device_error_address = istream.read_uint32();
-    error_resolution = istream.read_uint32();
+    error_type = static_cast<memory_error_type>(reader.read_uint8());
+    error_granularity = static_cast<memory_error_granularity>(reader.read_uint8());
+    error_operation = static_cast<memory_error_operation>(reader.read_uint8());
+    vendor_syndrome = reader.read_uint32();
+    memory_array_error_address = reader.read_uint32();
+    device_error_address = reader.read_uint32();
+    error_resolution = reader.read_uint32();
   }
 }
 
-void memory_array_mapped_address::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void memory_array_mapped_address::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_1) {
-    starting_address = istream.read_uint32();
-    ending_address = istream.read_uint32();
-    memory_array_handle = istream.read_uint16();
-    partition_width = istream.sbumpc();
+    starting_address = reader.read_uint32();
+    ending_address = reader.read_uint32();
+    memory_array_handle = reader.read_uint16();
+    partition_width = reader.read_uint8();
   }
   if (parser->version >= smbios_version::smbios_2_7) {
-    extended_starting_address = istream.read_uint64();
-    extended_ending_address = istream.read_uint64();
+    extended_starting_address = reader.read_uint64();
+    extended_ending_address = reader.read_uint64();
   }
 }
 
-void system_boot_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  istream.sgetn(reinterpret_cast<char*>(reserved), sizeof(reserved));
-  istream.sgetn(reinterpret_cast<char*>(boot_status), sizeof(boot_status));
+void system_boot_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_bytes(reserved, sizeof(reserved));
+  reader.read_bytes(boot_status, sizeof(boot_status));
 }
 
-void tpm_device::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  istream.sgetn(reinterpret_cast<char*>(vendor_id), sizeof(vendor_id));
-  major_spec_version = istream.sbumpc();
-  minor_spec_version = istream.sbumpc();
-  firmware_version1 = istream.read_uint32();
-  firmware_version2 = istream.read_uint32();
-  description = istream.read_strings(header.length);
-  characteristics = istream.read_uint64();
-  oem_defined = istream.read_uint32();
+void tpm_device::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reader.read_bytes(vendor_id, sizeof(vendor_id));
+  major_spec_version = reader.read_uint8();
+  minor_spec_version = reader.read_uint8();
+  firmware_version1 = reader.read_uint32();
+  firmware_version2 = reader.read_uint32();
+  reader.read_strings(description);
+  characteristics = reader.read_uint64();
+  oem_defined = reader.read_uint32();
 }
 
 memory_device_attributes& memory_device_attributes::operator=(uint8_t new_value) {
@@ -466,115 +503,99 @@ memory_device_type_detail operator&(const memory_device_type_detail& lhs, const
   return static_cast<memory_device_type_detail>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void memory_device::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void memory_device::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_1) {
-    physical_memory_array_handle = istream.read_uint16();
-    memory_error_info_handle = istream.read_uint16();
-    total_width = istream.read_uint16();
-    data_width = istream.read_uint16();
-    size = istream.read_uint16();
-    form_factor = static_cast<memory_device_form_factor>(istream.sbumpc());
-    device_set = istream.sbumpc();
-    device_locator = istream.read_string(header.length);
-    bank_locator = istream.read_string(header.length);
-    memory_type = static_cast<memory_device_type>(istream.sbumpc());
-    type_detail = static_cast<memory_device_type_detail>(istream.read_uint16());
+    physical_memory_array_handle = reader.read_uint16();
+    memory_error_info_handle = reader.read_uint16();
+    total_width = reader.read_uint16();
+    data_width = reader.read_uint16();
+    size = reader.read_uint16();
+    form_factor = static_cast<memory_device_form_factor>(reader.read_uint8());
+    device_set = reader.read_uint8();
+    device_locator = reader.read_string();
+    bank_locator = reader.read_string();
+    memory_type = static_cast<memory_device_type>(reader.read_uint8());
+    type_detail = static_cast<memory_device_type_detail>(reader.read_uint16());
   }
   if (parser->version >= smbios_version::smbios_2_3) {
-    speed = istream.read_uint16();
-    manufacturer = istream.read_string(header.length);
-    serial_number = istream.read_string(header.length);
-    asset_tag = istream.read_string(header.length);
-    part_number = istream.read_string(header.length);
+    speed = reader.read_uint16();
+    manufacturer = reader.read_string();
+    serial_number = reader.read_string();
+    asset_tag = reader.read_string();
+    part_number = reader.read_string();
   }
   if (parser->version >= smbios_version::smbios_2_6) {
-    attributes = istream.sbumpc();
+    attributes = reader.read_uint8();
   }
   if (parser->version >= smbios_version::smbios_2_7) {
-    extended_size = istream.read_uint32();
-    configured_memory_speed = istream.read_uint16();
+    extended_size = reader.read_uint32();
+    configured_memory_speed = reader.read_uint16();
   }
   if (parser->version >= smbios_version::smbios_2_8) {
-    min_voltage = istream.read_uint16();
-    max_voltage = istream.read_uint16();
-    configured_voltage = istream.read_uint16();
+    min_voltage = reader.read_uint16();
+    max_voltage = reader.read_uint16();
+    configured_voltage = reader.read_uint16();
   }
   if (parser->version >= smbios_version::smbios_3_2) {
-    memory_technology = static_cast<enum memory_technology>(istream.sbumpc());
-    memory_operating_mode_capability = static_cast<enum memory_operating_mode_capability>(istream.read_uint16());
-    firmware_version = istream.read_string(header.length);
-    module_manufacturer_id = istream.read_uint16();
-    module_product_id = istream.read_uint16();
-    memory_subsystem_controller_manufacturer_id = istream.read_uint16();
-    memory_subsystem_controller_product_id = istream.read_uint16();
-    non_volatile_size = istream.read_uint64();
-    volatile_size = istream.read_uint64();
-    cache_size = istream.read_uint64();
-    logical_size = istream.read_uint64();
+    memory_technology = static_cast<enum memory_technology>(reader.read_uint8());
+    memory_operating_mode_capability = static_cast<enum memory_operating_mode_capability>(reader.read_uint16());
+    firmware_version = reader.read_string();
+    module_manufacturer_id = reader.read_uint16();
+    module_product_id = reader.read_uint16();
+    memory_subsystem_controller_manufacturer_id = reader.read_uint16();
+    memory_subsystem_controller_product_id = reader.read_uint16();
+    non_volatile_size = reader.read_uint64();
+    volatile_size = reader.read_uint64();
+    cache_size = reader.read_uint64();
+    logical_size = reader.read_uint64();
   }
   if (parser->version >= smbios_version::smbios_3_3) {
-    extended_speed = istream.read_uint32();
-    extended_configured_memory_speed = istream.read_uint32();
+    extended_speed = reader.read_uint32();
+    extended_configured_memory_speed = reader.read_uint32();
   }
   if (parser->version >= smbios_version::smbios_3_7) {
-    pmic0_manufacturer_id = istream.read_uint16();
-    pmic0_revision_number = istream.read_uint16();
-    rcd_manufacturer_id = istream.read_uint16();
-    rcd_revision_number = istream.read_uint16();
+    pmic0_manufacturer_id = reader.read_uint16();
+    pmic0_revision_number = reader.read_uint16();
+    rcd_manufacturer_id = reader.read_uint16();
+    rcd_revision_number = reader.read_uint16();
   }
 }
 
-void processor_additional_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  referenced_handle = istream.read_uint16();
-  block_length = istream.sbumpc();
-  processor_type = istream.sbumpc();
+void processor_additional_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  referenced_handle = reader.read_uint16();
+  block_length = reader.read_uint8();
+  processor_type = reader.read_uint8();
   processor_specific_data.resize(block_length);
-  istream.sgetn(reinterpret_cast<char*>(processor_specific_data.data()), block_length);
+  reader.read_bytes(processor_specific_data.data(), block_length);
 }
 
-void memory_device_mapped_address::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void memory_device_mapped_address::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_1) {
-    starting_address = istream.read_uint32();
-    ending_address = istream.read_uint32();
-    memory_device_handle = istream.read_uint16();
-    memory_arr_mapped_addr_handle = istream.read_uint16();
-    partition_row_position = istream.sbumpc();
-    interleave_position = istream.sbumpc();
-    interleaved_data_depth = istream.sbumpc();
-    extended_starting_address = istream.read_uint64();
-    extended_ending_address = istream.read_uint64();
-  }
-}
-
-void additional_info_entry::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  entry_length = istream.sbumpc();
-  referenced_handle = istream.read_uint16();
-  referenced_offset = istream.sbumpc();
-  string = istream.read_string(header.length);
-  value.resize(entry_length - 5);
-  istream.sgetn(reinterpret_cast<char*>(value.data()), static_cast<std::streamsize>(value.size()));
-
-  istream.seek_offset();
-  istream.sbumpc();
-
-  while (istream.pos() < istream.size()) {
-    auto a = istream.sbumpc();
-    if (a == 0 && istream.sgetc() == 0) {
-      istream.pubseekoff(-1, std::ios_base::cur);
-      break;
-    } else {
-      other.push_back(a);
-    }
+    starting_address = reader.read_uint32();
+    ending_address = reader.read_uint32();
+    memory_device_handle = reader.read_uint16();
+    memory_arr_mapped_addr_handle = reader.read_uint16();
+    partition_row_position = reader.read_uint8();
+    interleave_position = reader.read_uint8();
+    interleaved_data_depth = reader.read_uint8();
+    extended_starting_address = reader.read_uint64();
+    extended_ending_address = reader.read_uint64();
   }
 }
 
-void additional_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  num_of_additional_info_entries = istream.sbumpc();
+void additional_info_entry::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  entry_length = reader.read_uint8();
+  referenced_handle = reader.read_uint16();
+  referenced_offset = reader.read_uint8();
+  string = reader.read_string();
+  value.resize(entry_length > 5 ? entry_length - 5 : 0);
+  reader.read_bytes(value.data(), value.size());
+}
+
+void additional_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  num_of_additional_info_entries = reader.read_uint8();
   for (int i = 0; i < num_of_additional_info_entries; ++i) {
-    additional_info_entry entry;
-    entry.header.length = header.length;
-    entry.read_params(istream, parser);
-    entries.push_back(entry);
+    entries.emplace_back(resource).read_params(reader, parser);
   }
 }
 
@@ -598,49 +619,47 @@ slot_characteristics2 operator&(const slot_characteristics2& lhs, const slot_cha
   return static_cast<slot_characteristics2>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void peer_device::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  segment_group_number = istream.read_uint16();
-  bus_number = istream.sbumpc();
-  device_function_number = istream.sbumpc();
-  data_bus_width = istream.sbumpc();
+void peer_device::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  segment_group_number = reader.read_uint16();
+  bus_number = reader.read_uint8();
+  device_function_number = reader.read_uint8();
+  data_bus_width = reader.read_uint8();
 }
 
-void system_slots::read_params(bios_streambuf& istream, smbios_parser* parser) {
+void system_slots::read_params(bios_reader& reader, smbios_decode_context* parser) {
   if (parser->version >= smbios_version::smbios_2_0) {
-    slot_designation = istream.read_string(header.length);
-    slot_type = static_cast<system_slot_type>(istream.sbumpc());
-    slot_data_bus_width = static_cast<system_slot_width>(istream.sbumpc());
-    current_usage = static_cast<system_slot_current_usage>(istream.sbumpc());
-    slot_length = static_cast<system_slot_length>(istream.sbumpc());
-    slot_id = istream.read_uint16();
-    slot_characteristics1 = static_cast<enum slot_characteristics1>(istream.sbumpc());
+    slot_designation = reader.read_string();
+    slot_type = static_cast<system_slot_type>(reader.read_uint8());
+    slot_data_bus_width = static_cast<system_slot_width>(reader.read_uint8());
+    current_usage = static_cast<system_slot_current_usage>(reader.read_uint8());
+    slot_length = static_cast<system_slot_length>(reader.read_uint8());
+    slot_id = reader.read_uint16();
+    slot_characteristics1 = static_cast<enum slot_characteristics1>(reader.read_uint8());
   }
   if (parser->version >= smbios_version::smbios_2_1) {
-    slot_characteristics2 = static_cast<enum slot_characteristics2>(istream.sbumpc());
+    slot_characteristics2 = static_cast<enum slot_characteristics2>(reader.read_uint8());
   }
   if (header.length >= 17) {
-    segment_group_number = istream.read_uint16();
-    bus_number = istream.sbumpc();
-    device_function_number = istream.sbumpc();
+    segment_group_number = reader.read_uint16();
+    bus_number = reader.read_uint8();
+    device_function_number = reader.read_uint8();
   }
   if (header.length >= 19) {
-    data_bus_width = istream.sbumpc();
-    peer_grouping_count = istream.sbumpc();
+    data_bus_width = reader.read_uint8();
+    peer_grouping_count = reader.read_uint8();
     if (header.length >= 19 + peer_grouping_count * 5) {
-      for (int i = 0; i <= peer_grouping_count; ++i) {
-        peer_device device;
-        device.read_params(istream, parser);
-        peer_groups.push_back(device);
+      for (int i = 0; i < peer_grouping_count; ++i) {
+        peer_groups.emplace_back(resource).read_params(reader, parser);
       }
     }
   }
   if (header.length >= 23 + peer_grouping_count * 5) {
-    slot_info = istream.sbumpc();
-    slot_physical_width = istream.sbumpc();
-    slot_pitch = istream.read_uint16();
+    slot_info = reader.read_uint8();
+    slot_physical_width = reader.read_uint8();
+    slot_pitch = reader.read_uint16();
   }
   if (header.length >= 24 + peer_grouping_count * 5) {
-    slot_height = istream.sbumpc();
+    slot_height = reader.read_uint8();
   }
 }
 
@@ -651,13 +670,13 @@ onboard_device_type& onboard_device_type::operator=(uint8_t new_value) {
   return *this;
 }
 
-void onboard_devices_extended_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  reference_designation = istream.read_string(header.length);
-  device_type = istream.sbumpc();
-  device_type_instance = istream.sbumpc();
-  segment_group_number = istream.read_uint16();
-  bus_number = istream.sbumpc();
-  device_function_number = istream.sbumpc();
+void onboard_devices_extended_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  reference_designation = reader.read_string();
+  device_type = reader.read_uint8();
+  device_type_instance = reader.read_uint8();
+  segment_group_number = reader.read_uint16();
+  bus_number = reader.read_uint8();
+  device_function_number = reader.read_uint8();
 }
 
 firmware_inventory_characteristics operator|(const firmware_inventory_characteristics& lhs,
@@ -672,45 +691,40 @@ firmware_inventory_characteristics operator&(const firmware_inventory_characteri
   return static_cast<firmware_inventory_characteristics>(static_cast<T>(lhs) & static_cast<T>(rhs));
 }
 
-void firmware_inventory_info::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  firmware_component_name = istream.read_string(header.length);
-  firmware_version = istream.read_string(header.length);
-  version_format = istream.sbumpc();
-  firmware_id = istream.read_string(header.length);
-  firmware_id_format = istream.sbumpc();
-  release_date = istream.read_string(header.length);
-  manufacturer = istream.read_string(header.length);
-  lowest_supported_firmware_version = istream.read_string(header.length);
-  image_size = istream.read_uint64();
-  characteristics = static_cast<firmware_inventory_characteristics>(istream.read_uint16());
-  state = istream.sbumpc();
-  num_of_associated_components = istream.sbumpc();
+void firmware_inventory_info::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  firmware_component_name = reader.read_string();
+  firmware_version = reader.read_string();
+  version_format = reader.read_uint8();
+  firmware_id = reader.read_string();
+  firmware_id_format = reader.read_uint8();
+  release_date = reader.read_string();
+  manufacturer = reader.read_string();
+  lowest_supported_firmware_version = reader.read_string();
+  image_size = reader.read_uint64();
+  characteristics = static_cast<firmware_inventory_characteristics>(reader.read_uint16());
+  state = reader.read_uint8();
+  num_of_associated_components = reader.read_uint8();
   for (int i = 0; i < num_of_associated_components; ++i) {
-    associated_component_handles.push_back(istream.read_uint16());
+    associated_component_handles.push_back(reader.read_uint16());
   }
 }
 
-void unknown_struct::read_params(bios_streambuf& istream, smbios_parser* parser) {
-  data.resize(header.length - 4);
-  istream.sgetn(reinterpret_cast<char*>(data.data()), (std::streamsize)data.size());
-  while (istream.pos() < istream.size()) {
-    uint8_t a = istream.sbumpc();
-    if (a == 0 && istream.sgetc() == 0) {
-      istream.pubseekoff(-1, std::ios_base::cur);
-      break;
-    } else {
-      data.push_back(a);
-    }
-  }
+void unknown_struct::read_params(bios_reader& reader, smbios_decode_context* parser) {
+  auto strings = reader.strings()->bytes();
+  auto formatted = reader.remaining();
+  data.resize(formatted + strings.size());
+  reader.read_bytes(data.data(), formatted);
+  std::memcpy(data.data() + formatted, strings.data(), strings.size());
 }
 
 std::vector<std::string> unknown_struct::to_strings() const {
   std::vector<std::string> strs;
-  auto start = data.data() + header.length - 4;
-  while (start < data.data() + data.size()) {
-    auto count = std::min(data.size() - (start - data.data()), std::strlen((const char*)start) + 1);
-    strs.emplace_back((const char*)start, count);
-    start += count;
+  auto start = reinterpret_cast<const char*>(data.data()) + header.length - 4;
+  auto end = reinterpret_cast<const char*>(data.data()) + data.size();
+  while (start < end) {
+    auto nul = static_cast<const char*>(std::memchr(start, '\0', end - start));
+    strs.emplace_back(start, nul ? nul : end);
+    start = nul ? nul + 1 : end;
   }
   return strs;
 }
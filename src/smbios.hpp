@@ -6,10 +6,15 @@
 #define SMBIOS_SMBIOS_HPP
 
 #include <string>
+#include <array>
 #include <cinttypes>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <variant>
 #include <vector>
-#include <streambuf>
-#include "bios_streambuf.hpp"
+#include "bios_reader.hpp"
 
 //Version
 enum class smbios_version : uint32_t {
@@ -95,27 +100,115 @@ enum class smbios_type : uint8_t {
   end_of_table = 127
 };
 
+// Set of structure type bytes, e.g.
+// {smbios_type::system_information, smbios_type::bios_information}.
+class smbios_type_mask {
+  std::array<uint64_t, 4> bits{};
+
+public:
+  constexpr smbios_type_mask() = default;
+
+  constexpr smbios_type_mask(std::initializer_list<smbios_type> types) {
+    for (auto type : types) {
+      set(type);
+    }
+  }
+
+  // Types of the given structure classes.
+  template<typename... Ts> requires (requires { Ts::TYPE; } && ...)
+  static constexpr smbios_type_mask of() {
+    return {Ts::TYPE...};
+  }
+
+  static constexpr smbios_type_mask all() {
+    smbios_type_mask mask;
+    mask.bits.fill(~uint64_t{0});
+    return mask;
+  }
+
+  constexpr void set(smbios_type type) {
+    auto t = static_cast<uint8_t>(type);
+    bits[t >> 6] |= uint64_t{1} << (t & 63);
+  }
+
+  [[nodiscard]] constexpr bool contains(smbios_type type) const {
+    auto t = static_cast<uint8_t>(type);
+    return bits[t >> 6] >> (t & 63) & 1;
+  }
+
+  constexpr bool operator==(const smbios_type_mask& other) const = default;
+};
+
 struct smbios_header {
   smbios_type type{};
   uint8_t length{};
   uint16_t handle{};
 
-  void read(bios_streambuf& istream);
+  void read(bios_reader& reader);
 };
 
-struct smbios_parser;
+// One structure located in the table: its header, formatted area and indexed
+// string set. Constructing it moves the reader past the structure terminator.
+struct smbios_structure {
+  smbios_header header;
+  // Formatted area after the header.
+  std::span<const std::byte> formatted;
+  bios_string_table strings;
+
+  explicit smbios_structure(bios_reader& reader);
+
+  [[nodiscard]] bios_reader formatted_reader() const {
+    return bios_reader(formatted, &strings);
+  }
+};
+
+// Bytes taken by the structure at the start of `table`, string set and
+// terminator included. Throws std::runtime_error like smbios_structure.
+std::size_t smbios_structure_size(std::span<const std::byte> table);
+
+// What decoding needs beyond the structure bytes, shared by every parser.
+struct smbios_decode_context {
+  // major << 8 | minor of the table, gates the fields each structure has.
+  uint32_t version = 0;
+};
 
 struct smbios {
   smbios_header header;
+  // Backs every string and vector of the structure.
+  std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+
+  smbios() = default;
 
-  void read(bios_streambuf& istream, smbios_parser* parser);
+  explicit smbios(std::pmr::memory_resource* resource) : resource(resource) {
+  }
 
-  virtual void read_params(bios_streambuf& istream, smbios_parser* parser) = 0;
+  void read(bios_reader& reader, smbios_decode_context* parser);
+
+  virtual void read_params(bios_reader& reader, smbios_decode_context* parser) = 0;
 
   virtual ~smbios() = default;
 };
 
+// Same as smbios::read but calls T's decoder directly instead of through the vtable.
+template<typename T> requires std::is_base_of_v<smbios, T>
+void smbios_read(T& s, bios_reader& reader, smbios_decode_context* parser) {
+  smbios_structure structure(reader);
+  s.header = structure.header;
+  auto formatted = structure.formatted_reader();
+  s.T::read_params(formatted, parser);
+}
+
 struct smbios_entry_point : smbios {
+  using smbios::smbios;
+
+  // major << 8 | minor
+  [[nodiscard]] virtual uint32_t version() const = 0;
+
+  // Physical address of the structure table, its offset in a dump image.
+  [[nodiscard]] virtual uint64_t table_address() const = 0;
+
+  // Table length, an upper bound for SMBIOS 3.0 entry points.
+  [[nodiscard]] virtual uint32_t table_length() const = 0;
 };
 
 //SMBIOS 2.1 (32-bit) Entry Point structure
@@ -136,7 +229,19 @@ struct smbios_entry_point32 : smbios_entry_point {
   uint8_t smbios_bcd_revision{};
 
 
-  void read_params(bios_streambuf& istream, smbios_parser* parser) override;
+  void read_params(bios_reader& reader, smbios_decode_context* parser) override;
+
+  [[nodiscard]] uint32_t version() const override {
+    return smbios_major_version << 8 | smbios_minor_version;
+  }
+
+  [[nodiscard]] uint64_t table_address() const override {
+    return structure_table_addr;
+  }
+
+  [[nodiscard]] uint32_t table_length() const override {
+    return structure_table_length;
+  }
 };
 
 //SMBIOS 3.0 (64-bit) Entry Point structure
@@ -153,9 +258,24 @@ struct smbios_entry_point64 : smbios_entry_point {
   uint64_t structure_table_addr{};
 
 
-  void read_params(bios_streambuf& istream, smbios_parser* parser) override;
+  void read_params(bios_reader& reader, smbios_decode_context* parser) override;
+
+  [[nodiscard]] uint32_t version() const override {
+    return smbios_major_version << 8 | smbios_minor_version;
+  }
+
+  [[nodiscard]] uint64_t table_address() const override {
+    return structure_table_addr;
+  }
+
+  [[nodiscard]] uint32_t table_length() const override {
+    return structure_table_max_size;
+  }
 };
 
+// Decodes a "_SM_" or "_SM3_" entry point, nullptr for any other anchor.
+std::unique_ptr<smbios_entry_point> read_entry_point(std::span<const std::byte> bytes);
+
 
 //7.1 BIOS Information (Type 0)
 enum class bios_characteristics : uint64_t {
@@ -242,11 +362,12 @@ extended_bios_rom_size operator&(const extended_bios_rom_size& lhs, const extend
 
 struct bios_info : smbios {
   static constexpr auto TYPE = smbios_type::bios_information;
+  using smbios::smbios;
   //version 2.0+
-  std::string vendor{};
-  std::string bios_version{};
+  smbios_string vendor{resource};
+  smbios_string bios_version{resource};
   uint16_t bios_starting_addr_seg{};
-  std::string bios_release_date{};
+  smbios_string bios_release_date{resource};
   uint8_t bios_rom_size{}; //kb = (bios_rom_size + 1) * 64k
   enum bios_characteristics bios_characteristics{};
   //version 2.4+
@@ -259,7 +380,7 @@ struct bios_info : smbios {
   //version 3.1+
   enum extended_bios_rom_size extended_bios_rom_size{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* parser) override;
+  void read_params(bios_reader& reader, smbios_decode_context* parser) override;
 
   [[nodiscard]] bool has_characteristics(const enum bios_characteristics& characteristics) const;
 
@@ -290,19 +411,20 @@ wake_up_type operator&(const wake_up_type& lhs, const wake_up_type& rhs);
 
 struct system_info : smbios {
   static constexpr auto TYPE = smbios_type::system_information;
+  using smbios::smbios;
   //version 2.0+
-  std::string manufacturer;
-  std::string product_name;
-  std::string version;
-  std::string serial_number;
+  smbios_string manufacturer{resource};
+  smbios_string product_name{resource};
+  smbios_string version{resource};
+  smbios_string serial_number{resource};
   //version 2.1+
   uint8_t uuid[16]{};
   enum wake_up_type wake_up_type{};
   //version 2.4+
-  std::string sku_number;
-  std::string family;
+  smbios_string sku_number{resource};
+  smbios_string family{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class feature_flag : uint8_t {
@@ -338,19 +460,20 @@ enum class board_type : uint8_t {
 //Baseboard (or Module) Information (Type 2)
 struct baseboard_info : smbios {
   static constexpr auto TYPE = smbios_type::baseboard_information;
-  std::string manufacturer;
-  std::string product;
-  std::string version;
-  std::string serial_number;
-  std::string asset_tag;
+  using smbios::smbios;
+  smbios_string manufacturer{resource};
+  smbios_string product{resource};
+  smbios_string version{resource};
+  smbios_string serial_number{resource};
+  smbios_string asset_tag{resource};
   feature_flag feature_flags{};
-  std::string location_in_chassis;
+  smbios_string location_in_chassis{resource};
   uint16_t chassis_handle{};
   enum board_type board_type{};
   uint8_t num_of_contained_object_handles{};
-  std::vector<uint16_t> contained_object_handles;
+  std::pmr::vector<uint16_t> contained_object_handles{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class chassis_type : uint8_t {
@@ -417,12 +540,13 @@ enum class security_status : uint8_t {
 //System Enclosure or Chassis (Type 3) structure
 struct system_enclosure : smbios {
   static constexpr auto TYPE = smbios_type::system_enclosure;
+  using smbios::smbios;
   //2.0+
-  std::string manufacturer;
+  smbios_string manufacturer{resource};
   chassis_type type{};
-  std::string version;
-  std::string serial_number;
-  std::string asset_tag_number;
+  smbios_string version{resource};
+  smbios_string serial_number{resource};
+  smbios_string asset_tag_number{resource};
   //2.1+
   system_enclosure_state boot_up_state{};
   system_enclosure_state power_supply_state{};
@@ -434,11 +558,11 @@ struct system_enclosure : smbios {
   uint8_t num_of_power_cords{};
   uint8_t contained_element_count{};
   uint8_t contained_element_record_length{};
-  std::vector<uint8_t> contained_elements;
+  std::pmr::vector<uint8_t> contained_elements{resource};
   //2.7+
-  std::string sku_number;
+  smbios_string sku_number{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class processor_upgrade : uint8_t {
@@ -697,13 +821,14 @@ struct cpu_status {
 //Processor Information (Type 4)
 struct processor_info : smbios {
   static constexpr auto TYPE = smbios_type::processor_information;
+  using smbios::smbios;
   //2.0+
-  std::string socket_designation;
+  smbios_string socket_designation{resource};
   enum processor_type processor_type{};
   enum processor_family processor_family{};
-  std::string processor_manufacturer;
+  smbios_string processor_manufacturer{resource};
   uint64_t processor_id{};
-  std::string processor_version;
+  smbios_string processor_version{resource};
   uint8_t voltage{};
   uint16_t external_clock{};
   uint16_t max_speed{};
@@ -715,9 +840,9 @@ struct processor_info : smbios {
   uint16_t l2_cache_handle{};
   uint16_t l3_cache_handle{};
   //2.3+
-  std::string serial_number;
-  std::string asset_tag;
-  std::string part_number;
+  smbios_string serial_number{resource};
+  smbios_string asset_tag{resource};
+  smbios_string part_number{resource};
   //2.5+
   uint8_t core_count{};
   uint8_t core_enabled{};
@@ -730,7 +855,7 @@ struct processor_info : smbios {
   uint16_t core_enabled_2{};
   uint16_t thread_count_2{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 
   [[nodiscard]] bool has_processor_characteristics(const enum processor_characteristics& characteristics) const;
 };
@@ -855,8 +980,9 @@ struct cache_size2 {
 //7.8 Cache Information (Type 7)
 struct cache_info : smbios {
   static constexpr auto TYPE = smbios_type::cache_information;
+  using smbios::smbios;
   //2.0+
-  std::string socket_designation;
+  smbios_string socket_designation{resource};
   struct cache_configuration cache_configuration{};
   cache_size max_cache_size{};
   cache_size installed_size{};
@@ -871,7 +997,7 @@ struct cache_info : smbios {
   cache_size2 max_cache_size2{};
   cache_size2 installed_cache_size2{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 
@@ -967,29 +1093,32 @@ enum class port_type : uint8_t {
 //7.9 Port Connector Information (Type 8)
 struct port_connector_info : smbios {
   static constexpr auto TYPE = smbios_type::port_connector_information;
-  std::string internal_ref_designator;
+  using smbios::smbios;
+  smbios_string internal_ref_designator{resource};
   connector_type internal_connector_type{};
-  std::string external_ref_designator;
+  smbios_string external_ref_designator{resource};
   connector_type external_connector_type{};
   enum port_type port_type{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //7.12 OEM Strings (Type 11)
 struct oem_strings : smbios {
   static constexpr auto TYPE = smbios_type::oem_strings;
-  std::vector<std::string> strings;
+  using smbios::smbios;
+  std::pmr::vector<smbios_string> strings{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 
 struct system_configuration_options : smbios {
   static constexpr auto TYPE = smbios_type::system_configuration_options;
-  std::vector<std::string> strings;
+  using smbios::smbios;
+  std::pmr::vector<smbios_string> strings{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class memory_array_location : uint8_t {
@@ -1035,6 +1164,7 @@ enum class memory_array_error_correction : uint8_t {
 //7.17 Physical Memory Array (Type 16)
 struct physical_memory_array : smbios {
   static constexpr auto TYPE = smbios_type::physical_memory_array;
+  using smbios::smbios;
   //2.1+
   memory_array_location location{};
   memory_array_use use{};
@@ -1045,7 +1175,7 @@ struct physical_memory_array : smbios {
   //2.7+
   uint64_t extended_max_capacity{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class memory_error_type : uint8_t {
@@ -1083,6 +1213,7 @@ enum class memory_error_operation : uint8_t {
 //7.19 32-Bit Memory Error Information (Type 18)
 struct memory_error_info : smbios {
   static constexpr auto TYPE = smbios_type::memory_error_information_32;
+  using smbios::smbios;
   //2.1+
   memory_error_type error_type{};
   memory_error_granularity error_granularity{};
@@ -1092,12 +1223,13 @@ struct memory_error_info : smbios {
   uint32_t device_error_address{};
   uint32_t error_resolution{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //7.20 Memory Array Mapped Address (Type 19)
 struct memory_array_mapped_address : smbios {
   static constexpr auto TYPE = smbios_type::memory_array_mapped_address;
+  using smbios::smbios;
   //2.1+
   uint32_t starting_address{};
   uint32_t ending_address{};
@@ -1107,32 +1239,34 @@ struct memory_array_mapped_address : smbios {
   uint64_t extended_starting_address{};
   uint64_t extended_ending_address{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //7.33 System Boot Information (Type 32)
 struct system_boot_info : smbios {
   static constexpr auto TYPE = smbios_type::system_boot_information;
+  using smbios::smbios;
   uint8_t reserved[6]{};
   uint8_t boot_status[10]{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 
 //7.44 TPM Device (Type 43)
 struct tpm_device : smbios {
   static constexpr auto TYPE = smbios_type::tpm_device;
+  using smbios::smbios;
   uint8_t vendor_id[4]{};
   uint8_t major_spec_version{};
   uint8_t minor_spec_version{};
   uint32_t firmware_version1{};
   uint32_t firmware_version2{};
-  std::vector<std::string> description;
+  std::pmr::vector<smbios_string> description{resource};
   uint64_t characteristics{};
   uint32_t oem_defined{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class memory_device_form_factor : uint8_t {
@@ -1266,6 +1400,7 @@ struct memory_device_extended_speed {
 //7.18 Memory Device (Type 17)
 struct memory_device : smbios {
   static constexpr auto TYPE = smbios_type::memory_device;
+  using smbios::smbios;
   //2.1+
   uint16_t physical_memory_array_handle{};
   uint16_t memory_error_info_handle{};
@@ -1274,16 +1409,16 @@ struct memory_device : smbios {
   uint16_t size{};
   memory_device_form_factor form_factor{};
   uint8_t device_set{};
-  std::string device_locator;
-  std::string bank_locator;
+  smbios_string device_locator{resource};
+  smbios_string bank_locator{resource};
   memory_device_type memory_type{};
   memory_device_type_detail type_detail{};
   //2.3+
   uint16_t speed{};
-  std::string manufacturer;
-  std::string serial_number;
-  std::string asset_tag;
-  std::string part_number;
+  smbios_string manufacturer{resource};
+  smbios_string serial_number{resource};
+  smbios_string asset_tag{resource};
+  smbios_string part_number{resource};
   //2.6+
   memory_device_attributes attributes{};
   //2.7+
@@ -1296,7 +1431,7 @@ struct memory_device : smbios {
   //3.2+
   enum memory_technology memory_technology{};
   enum memory_operating_mode_capability memory_operating_mode_capability{};
-  std::string firmware_version;
+  smbios_string firmware_version{resource};
   uint16_t module_manufacturer_id{};
   uint16_t module_product_id{};
   uint16_t memory_subsystem_controller_manufacturer_id{};
@@ -1314,23 +1449,25 @@ struct memory_device : smbios {
   uint16_t rcd_manufacturer_id{};
   uint16_t rcd_revision_number{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //Table 128 – Processor Additional Information (Type 44) structure
 struct processor_additional_info : smbios {
   static constexpr auto TYPE = smbios_type::processor_additional_information;
+  using smbios::smbios;
   uint16_t referenced_handle{};
   uint8_t block_length{};
   uint8_t processor_type{};
-  std::vector<uint8_t> processor_specific_data;
+  std::pmr::vector<uint8_t> processor_specific_data{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //Table 86 – Memory Device Mapped Address (Type 20) structure
 struct memory_device_mapped_address : smbios {
   static constexpr auto TYPE = smbios_type::memory_device_mapped_address;
+  using smbios::smbios;
   //2.1+
   uint32_t starting_address{};
   uint32_t ending_address{};
@@ -1342,27 +1479,28 @@ struct memory_device_mapped_address : smbios {
   uint64_t extended_starting_address{};
   uint64_t extended_ending_address{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 struct additional_info_entry : smbios {
+  using smbios::smbios;
   uint8_t entry_length{};
   uint16_t referenced_handle{};
   uint8_t referenced_offset{};
-  std::string string;
-  std::vector<uint8_t> value;
-  std::vector<uint8_t> other;
+  smbios_string string{resource};
+  std::pmr::vector<uint8_t> value{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 //Table 118 – Additional Information (Type 40) structure
 struct additional_info : smbios {
   static constexpr auto TYPE = smbios_type::additional_information;
+  using smbios::smbios;
   uint8_t num_of_additional_info_entries{};
-  std::vector<additional_info_entry> entries;
+  std::pmr::vector<additional_info_entry> entries{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class system_slot_type : uint8_t {
@@ -1506,19 +1644,21 @@ slot_characteristics2 operator|(const slot_characteristics2& lhs, const slot_cha
 slot_characteristics2 operator&(const slot_characteristics2& lhs, const slot_characteristics2& rhs);
 
 struct peer_device : smbios {
+  using smbios::smbios;
   uint16_t segment_group_number;
   uint8_t bus_number;
   uint8_t device_function_number;
   uint8_t data_bus_width;
 
-  void read_params(bios_streambuf& istream, smbios_parser* parser) override;
+  void read_params(bios_reader& reader, smbios_decode_context* parser) override;
 };
 
 //Table 44 – System Slots (Type 9) structure
 struct system_slots : smbios {
   static constexpr auto TYPE = smbios_type::system_slots;
+  using smbios::smbios;
   //2.0+
-  std::string slot_designation;
+  smbios_string slot_designation{resource};
   system_slot_type slot_type{};
   system_slot_width slot_data_bus_width{};
   system_slot_current_usage current_usage{};
@@ -1534,7 +1674,7 @@ struct system_slots : smbios {
   //3.2
   uint8_t data_bus_width{};
   uint8_t peer_grouping_count{};
-  std::vector<peer_device> peer_groups;
+  std::pmr::vector<peer_device> peer_groups{resource};
   //3.4
   uint8_t slot_info{};
   uint8_t slot_physical_width{};
@@ -1542,7 +1682,7 @@ struct system_slots : smbios {
   //3.5
   uint8_t slot_height{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class device_status : uint8_t {
@@ -1580,14 +1720,15 @@ struct onboard_device_type {
 //Table 120 – Onboard Devices Extended Information (Type 41) structure
 struct onboard_devices_extended_info : smbios {
   static constexpr auto TYPE = smbios_type::onboard_devices_extended_info;
-  std::string reference_designation;
+  using smbios::smbios;
+  smbios_string reference_designation{resource};
   onboard_device_type device_type{};
   uint8_t device_type_instance{};
   uint16_t segment_group_number{};
   uint8_t bus_number{};
   uint8_t device_function_number{};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 enum class firmware_inventory_characteristics : uint16_t {
@@ -1604,31 +1745,72 @@ firmware_inventory_characteristics operator&(const firmware_inventory_characteri
 //7.46 Firmware Inventory Information (Type 45)
 struct firmware_inventory_info : smbios {
   static constexpr auto TYPE = smbios_type::firmware_inventory_information;
-  std::string firmware_component_name;
-  std::string firmware_version;
+  using smbios::smbios;
+  smbios_string firmware_component_name{resource};
+  smbios_string firmware_version{resource};
   uint8_t version_format{};
-  std::string firmware_id;
+  smbios_string firmware_id{resource};
   uint8_t firmware_id_format{};
-  std::string release_date;
-  std::string manufacturer;
-  std::string lowest_supported_firmware_version;
+  smbios_string release_date{resource};
+  smbios_string manufacturer{resource};
+  smbios_string lowest_supported_firmware_version{resource};
   uint64_t image_size{};
   firmware_inventory_characteristics characteristics{};
   uint8_t state{};
   uint8_t num_of_associated_components{};
-  std::vector<uint16_t> associated_component_handles;
+  std::pmr::vector<uint16_t> associated_component_handles{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 };
 
 
 struct unknown_struct : smbios {
-  std::vector<uint8_t> data;
+  using smbios::smbios;
+  std::pmr::vector<uint8_t> data{resource};
 
-  void read_params(bios_streambuf& istream, smbios_parser* smbios) override;
+  void read_params(bios_reader& reader, smbios_decode_context* smbios) override;
 
   [[nodiscard]] std::vector<std::string> to_strings() const;
 };
 
+template<typename... Ts>
+struct smbios_type_list {
+};
+
+template<typename List>
+struct smbios_variant_of;
+
+template<typename... Ts>
+struct smbios_variant_of<smbios_type_list<Ts...>> {
+  using type = std::variant<Ts..., unknown_struct>;
+};
+
+// Every structure class smbios_parser decodes, dispatched on T::TYPE.
+using smbios_types = smbios_type_list<
+  bios_info,
+  system_info,
+  baseboard_info,
+  system_enclosure,
+  processor_info,
+  cache_info,
+  port_connector_info,
+  system_slots,
+  oem_strings,
+  system_configuration_options,
+  physical_memory_array,
+  memory_device,
+  memory_error_info,
+  memory_array_mapped_address,
+  memory_device_mapped_address,
+  system_boot_info,
+  additional_info,
+  onboard_devices_extended_info,
+  tpm_device,
+  processor_additional_info,
+  firmware_inventory_info
+>;
+
+// Holds any decoded structure by value, types without a decoder as unknown_struct.
+using smbios_variant = smbios_variant_of<smbios_types>::type;
 
 #endif //SMBIOS_SMBIOS_HPP
@@ -0,0 +1,226 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_archive.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#include "smbios_parser.hpp"
+
+template<typename T> requires std::is_integral_v<T>
+static void store_le(uint8_t* dst, T value) {
+  if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+    value = std::byteswap(value);
+  }
+  std::memcpy(dst, &value, sizeof(T));
+}
+
+static uint64_t align8(uint64_t offset) {
+  return (offset + 7) & ~uint64_t{7};
+}
+
+// Calls f(offset, length) for each string of the structure in `bytes`, whose
+// boundaries the parser has already checked.
+template<typename F>
+static void for_each_string(std::span<const std::byte> bytes, F&& f) {
+  auto position = static_cast<std::size_t>(bytes[1]);
+  while (position < bytes.size() && bytes[position] != std::byte{0}) {
+    auto end = static_cast<std::size_t>(std::find(bytes.begin() + position, bytes.end(), std::byte{0}) - bytes.begin());
+    f(position, end - position);
+    position = end + 1;
+  }
+}
+
+void write_smbios_archive(const smbios_parser& parser, std::vector<uint8_t>& out) {
+  auto table = parser.table.bytes();
+  auto bounds = parser.table_bounds();
+  auto structure_bytes = [&](std::size_t i) {
+    return table.subspan(bounds[i].offset, bounds[i].size);
+  };
+
+  smbios_archive_header header;
+  header.version = parser.version;
+  header.structure_count = static_cast<uint32_t>(bounds.size());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    for_each_string(structure_bytes(i), [&](std::size_t, std::size_t) { ++header.string_count; });
+    header.data_size += bounds[i].size;
+  }
+  header.structures = smbios_archive_header::SIZE;
+  header.strings = align8(header.structures + 16 * uint64_t{header.structure_count});
+  header.handles = align8(header.strings + 8 * uint64_t{header.string_count});
+  header.types = align8(header.handles + 8 * uint64_t{header.structure_count});
+  header.data = align8(header.types + 4 * (257 + uint64_t{header.structure_count}));
+  header.size = header.data + header.data_size;
+
+  auto base = out.size();
+  out.resize(base + header.size);
+  auto archive = out.data() + base;
+
+  std::size_t position = 0;
+  auto put = [&](auto value) {
+    store_le(archive + position, value);
+    position += sizeof(value);
+  };
+  put(header.magic);
+  put(header.format);
+  put(header.header_size);
+  put(header.version);
+  put(header.structure_count);
+  put(header.string_count);
+  put(header.reserved);
+  put(header.size);
+  put(header.structures);
+  put(header.strings);
+  put(header.handles);
+  put(header.types);
+  put(header.data);
+  put(header.data_size);
+
+  // Structures, their strings and bytes in one pass.
+  uint32_t data_offset = 0;
+  uint32_t string_index = 0;
+  auto strings = archive + header.strings;
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    auto bytes = structure_bytes(i);
+    auto first_string = string_index;
+    for_each_string(bytes, [&](std::size_t offset, std::size_t length) {
+      store_le(strings + 8 * uint64_t{string_index}, static_cast<uint32_t>(offset));
+      store_le(strings + 8 * uint64_t{string_index} + 4, static_cast<uint32_t>(length));
+      ++string_index;
+    });
+    auto record = archive + header.structures + 16 * i;
+    store_le(record, data_offset);
+    store_le(record + 4, static_cast<uint32_t>(bytes.size()));
+    store_le(record + 8, first_string);
+    store_le(record + 12, string_index - first_string);
+    std::memcpy(archive + header.data + data_offset, bytes.data(), bytes.size());
+    data_offset += static_cast<uint32_t>(bytes.size());
+  }
+
+  // Handle, then index, in one key so equal handles stay in table order.
+  std::vector<uint64_t> handles(bounds.size());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    handles[i] = uint64_t{bios_load_le<uint16_t>(structure_bytes(i).data() + 2)} << 32 | i;
+  }
+  std::ranges::sort(handles);
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    auto record = archive + header.handles + 8 * i;
+    store_le(record, static_cast<uint16_t>(handles[i] >> 32));
+    store_le(record + 2, uint16_t{0});
+    store_le(record + 4, static_cast<uint32_t>(handles[i]));
+  }
+
+  std::array<uint32_t, 257> type_offsets{};
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    ++type_offsets[static_cast<uint8_t>(table[bounds[i].offset]) + 1];
+  }
+  for (std::size_t t = 1; t < type_offsets.size(); ++t) {
+    type_offsets[t] += type_offsets[t - 1];
+  }
+  auto types = archive + header.types;
+  for (std::size_t t = 0; t < type_offsets.size(); ++t) {
+    store_le(types + 4 * t, type_offsets[t]);
+  }
+  auto next = type_offsets;
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    auto t = static_cast<uint8_t>(table[bounds[i].offset]);
+    store_le(types + 4 * (257 + uint64_t{next[t]++}), static_cast<uint32_t>(i));
+  }
+}
+
+smbios_archive_view::smbios_archive_view(std::span<const std::byte> bytes) : bytes(bytes) {
+  bios_reader reader(bytes);
+  header.magic = reader.read_uint32();
+  header.format = reader.read_uint16();
+  header.header_size = reader.read_uint16();
+  header.version = reader.read_uint32();
+  header.structure_count = reader.read_uint32();
+  header.string_count = reader.read_uint32();
+  header.reserved = reader.read_uint32();
+  header.size = reader.read_uint64();
+  header.structures = reader.read_uint64();
+  header.strings = reader.read_uint64();
+  header.handles = reader.read_uint64();
+  header.types = reader.read_uint64();
+  header.data = reader.read_uint64();
+  header.data_size = reader.read_uint64();
+  if (bytes.size() < smbios_archive_header::SIZE || header.magic != smbios_archive_header::MAGIC) {
+    throw std::runtime_error("not an SMBIOS archive");
+  }
+  if (header.format != smbios_archive_header::FORMAT) {
+    throw std::runtime_error(std::format("unsupported SMBIOS archive format {}", header.format));
+  }
+
+  // Every offset is checked once here so the accessors need not.
+  auto fits = [&](uint64_t offset, uint64_t size) {
+    return offset <= bytes.size() && size <= bytes.size() - offset;
+  };
+  uint64_t n = header.structure_count;
+  if (header.header_size < smbios_archive_header::SIZE || header.size != bytes.size() ||
+      !fits(header.structures, 16 * n) || !fits(header.strings, 8 * uint64_t{header.string_count}) ||
+      !fits(header.handles, 8 * n) || !fits(header.types, 4 * (257 + n)) || !fits(header.data, header.data_size)) {
+    throw std::runtime_error("damaged SMBIOS archive");
+  }
+  auto data = bytes.subspan(header.data, header.data_size);
+  for (uint64_t i = 0; i < n; ++i) {
+    auto record = bytes.data() + header.structures + 16 * i;
+    uint64_t offset = bios_load_le<uint32_t>(record);
+    uint64_t size = bios_load_le<uint32_t>(record + 4);
+    uint64_t first_string = bios_load_le<uint32_t>(record + 8);
+    uint64_t string_count = bios_load_le<uint32_t>(record + 12);
+    if (size < 4 || offset > data.size() || size > data.size() - offset ||
+        static_cast<uint8_t>(data[offset + 1]) < 4 || static_cast<uint8_t>(data[offset + 1]) > size ||
+        first_string + string_count > header.string_count) {
+      throw std::runtime_error("damaged SMBIOS archive");
+    }
+    for (auto k = first_string; k < first_string + string_count; ++k) {
+      auto string = bytes.data() + header.strings + 8 * k;
+      uint64_t string_offset = bios_load_le<uint32_t>(string);
+      uint64_t length = bios_load_le<uint32_t>(string + 4);
+      if (string_offset + length >= size || data[offset + string_offset + length] != std::byte{0}) {
+        throw std::runtime_error("damaged SMBIOS archive");
+      }
+    }
+  }
+  for (uint64_t i = 0; i < n; ++i) {
+    if (load_u32(header.handles + 8 * i + 4) >= n) {
+      throw std::runtime_error("damaged SMBIOS archive");
+    }
+  }
+  for (uint64_t t = 0; t < 256; ++t) {
+    if (load_u32(header.types + 4 * t) > load_u32(header.types + 4 * (t + 1))) {
+      throw std::runtime_error("damaged SMBIOS archive");
+    }
+  }
+  if (load_u32(header.types) != 0 || load_u32(header.types + 4 * 256) != n) {
+    throw std::runtime_error("damaged SMBIOS archive");
+  }
+  for (uint64_t i = 0; i < n; ++i) {
+    if (load_u32(header.types + 4 * (257 + i)) >= n) {
+      throw std::runtime_error("damaged SMBIOS archive");
+    }
+  }
+}
+
+std::size_t smbios_archive_view::find_handle(uint16_t handle) const {
+  std::size_t first = 0;
+  std::size_t count = size();
+  while (count > 0) {
+    auto half = count / 2;
+    if (bios_load_le<uint16_t>(bytes.data() + header.handles + 8 * (first + half)) < handle) {
+      first += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+  if (first == size() || bios_load_le<uint16_t>(bytes.data() + header.handles + 8 * first) != handle) {
+    return size();
+  }
+  return load_u32(header.handles + 8 * first + 4);
+}
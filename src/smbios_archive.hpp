@@ -0,0 +1,199 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_ARCHIVE_HPP
+#define SMBIOS_SMBIOS_ARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "bios_reader.hpp"
+#include "smbios.hpp"
+
+struct smbios_parser;
+
+// Binary image of a parse, meant to be shipped and read in place. Every
+// integer is little-endian and every section is found through an offset from
+// the start of the archive, 8-byte aligned:
+//
+//   header      smbios_archive_header, fields in declaration order
+//   structures  per structure in table order: u32 offset and u32 size of its
+//               bytes in data, u32 index of its first string, u32 string count
+//   strings     per string: u32 offset from the start of its structure and
+//               u32 length, a NUL follows
+//   handles     per structure by ascending handle, table order among equal
+//               ones: u16 handle, u16 zero, u32 structure index
+//   types       u32[257] offsets, then u32 structure indices grouped by type
+//               byte, type t occupies [offsets[t], offsets[t + 1])
+//   data        the structures' raw bytes, string sets and terminators included
+struct smbios_archive_header {
+  static constexpr uint32_t MAGIC = 0x41424D53; // "SMBA"
+  // Readers reject any other format. Fields appended to the header within a
+  // format grow header_size instead.
+  static constexpr uint16_t FORMAT = 1;
+  static constexpr uint16_t SIZE = 80;
+
+  uint32_t magic = MAGIC;
+  uint16_t format = FORMAT;
+  uint16_t header_size = SIZE;
+  // smbios_parser::version of the parse.
+  uint32_t version{};
+  uint32_t structure_count{};
+  uint32_t string_count{};
+  uint32_t reserved{};
+  // Whole archive.
+  uint64_t size{};
+  uint64_t structures{};
+  uint64_t strings{};
+  uint64_t handles{};
+  uint64_t types{};
+  uint64_t data{};
+  uint64_t data_size{};
+};
+
+// Appends the archive of every structure `parser` kept to `out`, reusing its
+// capacity. Structures of a lazy parse are copied without being decoded.
+void write_smbios_archive(const smbios_parser& parser, std::vector<uint8_t>& out);
+
+// One structure of an archive, reading from the archive's bytes.
+class smbios_archive_structure {
+  const std::byte* bytes;
+  const std::byte* string_records;
+  uint32_t size;
+  uint32_t string_count;
+  uint32_t version;
+
+public:
+  smbios_archive_structure(const std::byte* bytes, uint32_t size, const std::byte* string_records,
+                           uint32_t string_count, uint32_t version) :
+    bytes(bytes),
+    string_records(string_records),
+    size(size),
+    string_count(string_count),
+    version(version) {
+  }
+
+  [[nodiscard]] smbios_type type() const {
+    return static_cast<smbios_type>(bytes[0]);
+  }
+
+  [[nodiscard]] uint8_t length() const {
+    return static_cast<uint8_t>(bytes[1]);
+  }
+
+  [[nodiscard]] uint16_t handle() const {
+    return bios_load_le<uint16_t>(bytes + 2);
+  }
+
+  // Header and formatted area, length() bytes.
+  [[nodiscard]] std::span<const std::byte> formatted() const {
+    return {bytes, length()};
+  }
+
+  // The structure as it was in the table, string set and terminator included.
+  [[nodiscard]] std::span<const std::byte> raw() const {
+    return {bytes, size};
+  }
+
+  // Field at `offset` from the start of the header, as the specification
+  // numbers them, zero when the structure is too short to have it.
+  template<typename T> requires std::is_integral_v<T>
+  [[nodiscard]] T field(std::size_t offset) const {
+    return offset + sizeof(T) <= length() ? bios_load_le<T>(bytes + offset) : T{};
+  }
+
+  [[nodiscard]] std::size_t strings() const {
+    return string_count;
+  }
+
+  // 1-based like the string fields themselves, 0 or a missing index is empty.
+  // The view is followed by a NUL.
+  [[nodiscard]] std::string_view string(std::size_t index) const {
+    if (index == 0 || index > string_count) {
+      return {};
+    }
+    auto record = string_records + (index - 1) * 8;
+    return {reinterpret_cast<const char*>(bytes) + bios_load_le<uint32_t>(record), bios_load_le<uint32_t>(record + 4)};
+  }
+
+  // Decodes the structure the way smbios_parser would, for the archive's
+  // version. Strings of a SMBIOS_STRING_VIEW build view the archive bytes.
+  template<typename T> requires std::is_base_of_v<smbios, T> && requires { T::TYPE; }
+  [[nodiscard]] T decode(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
+    T s(resource);
+    smbios_decode_context context{version};
+    bios_reader reader(raw());
+    smbios_read(s, reader, &context);
+    return s;
+  }
+};
+
+// Zero-copy reader over an archive, e.g. a file mapped by
+// table_buffer::load(path, load_strategy::mmap). The bytes must outlive the
+// view and every structure taken from it. Construction checks that every
+// section and record lies within the bytes, no structure is decoded.
+class smbios_archive_view {
+  std::span<const std::byte> bytes;
+  smbios_archive_header header;
+
+  [[nodiscard]] uint32_t load_u32(uint64_t offset) const {
+    return bios_load_le<uint32_t>(bytes.data() + offset);
+  }
+
+public:
+  // Throws std::runtime_error when `bytes` is not a well-formed archive.
+  explicit smbios_archive_view(std::span<const std::byte> bytes);
+
+  [[nodiscard]] uint32_t version() const {
+    return header.version;
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    return header.structure_count;
+  }
+
+  [[nodiscard]] bool empty() const {
+    return size() == 0;
+  }
+
+  // Structure `index` in table order.
+  [[nodiscard]] smbios_archive_structure operator[](std::size_t index) const {
+    auto record = bytes.data() + header.structures + 16 * index;
+    return {
+      bytes.data() + header.data + bios_load_le<uint32_t>(record),
+      bios_load_le<uint32_t>(record + 4),
+      bytes.data() + header.strings + 8 * uint64_t{bios_load_le<uint32_t>(record + 8)},
+      bios_load_le<uint32_t>(record + 12),
+      header.version,
+    };
+  }
+
+  // Index of the first structure with `handle` in table order, size() when
+  // there is none.
+  [[nodiscard]] std::size_t find_handle(uint16_t handle) const;
+
+  // Structures with the given type byte in table order.
+  [[nodiscard]] auto of_type(smbios_type type) const {
+    auto t = static_cast<uint8_t>(type);
+    auto first = load_u32(header.types + 4 * t);
+    auto last = load_u32(header.types + 4 * (t + 1));
+    return std::views::iota(first, last) | std::views::transform([this](uint32_t i) {
+      return (*this)[load_u32(header.types + 4 * 257 + 4 * uint64_t{i})];
+    });
+  }
+
+  // Archive bytes the view reads.
+  [[nodiscard]] std::span<const std::byte> data() const {
+    return bytes;
+  }
+};
+
+
+#endif //SMBIOS_SMBIOS_ARCHIVE_HPP
@@ -0,0 +1,220 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_batch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Fixed-capacity FIFO between the workers and the writer, push blocks while
+// it is full and pop while it is empty and still open.
+template<typename T>
+class bounded_queue {
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<T> items;
+  std::size_t capacity;
+  bool closed = false;
+
+public:
+  explicit bounded_queue(std::size_t capacity) : capacity(std::max<std::size_t>(capacity, 1)) {
+  }
+
+  void push(T item) {
+    std::unique_lock lock(mutex);
+    not_full.wait(lock, [&] { return items.size() < capacity; });
+    items.push_back(std::move(item));
+    not_empty.notify_one();
+  }
+
+  // false once the queue is closed and drained.
+  bool pop(T& item) {
+    std::unique_lock lock(mutex);
+    not_empty.wait(lock, [&] { return !items.empty() || closed; });
+    if (items.empty()) {
+      return false;
+    }
+    item = std::move(items.front());
+    items.pop_front();
+    not_full.notify_one();
+    return true;
+  }
+
+  void close() {
+    std::lock_guard lock(mutex);
+    closed = true;
+    not_empty.notify_all();
+  }
+};
+
+// Files still to parse by one worker. The owner takes from the front, idle
+// workers steal the back half.
+struct batch_range {
+  std::mutex mutex;
+  std::size_t begin = 0;
+  std::size_t end = 0;
+};
+
+// Serialization buffers handed back by the writer, so their capacity is
+// reused instead of allocating a string per file.
+class buffer_pool {
+  std::mutex mutex;
+  std::vector<std::string> buffers;
+
+public:
+  std::string take() {
+    std::lock_guard lock(mutex);
+    if (buffers.empty()) {
+      return {};
+    }
+    auto buffer = std::move(buffers.back());
+    buffers.pop_back();
+    return buffer;
+  }
+
+  void give(std::string buffer) {
+    buffer.clear();
+    std::lock_guard lock(mutex);
+    buffers.push_back(std::move(buffer));
+  }
+};
+
+std::vector<std::filesystem::path> batch_files(const std::filesystem::path& directory) {
+  std::vector<std::filesystem::path> files;
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.is_regular_file()) {
+      files.push_back(entry.path());
+    }
+  }
+  std::ranges::sort(files);
+  return files;
+}
+
+batch_result parse_batch(std::span<const std::filesystem::path> files, const batch_serializer& serialize,
+                         std::ostream& out, const batch_options& options) {
+  batch_result result{files.size(), 0};
+  if (files.empty()) {
+    return result;
+  }
+
+  std::size_t jobs = options.jobs ? options.jobs : std::thread::hardware_concurrency();
+  jobs = std::clamp<std::size_t>(jobs, 1, files.size());
+
+  // Contiguous shares up front, stealing evens out slow files and slow disks.
+  auto ranges = std::make_unique<batch_range[]>(jobs);
+  for (std::size_t i = 0; i < jobs; ++i) {
+    ranges[i].begin = files.size() * i / jobs;
+    ranges[i].end = files.size() * (i + 1) / jobs;
+  }
+
+  auto next_file = [&](std::size_t self) -> std::optional<std::size_t> {
+    {
+      std::lock_guard lock(ranges[self].mutex);
+      if (ranges[self].begin < ranges[self].end) {
+        return ranges[self].begin++;
+      }
+    }
+    for (std::size_t k = 1; k < jobs; ++k) {
+      auto& victim = ranges[(self + k) % jobs];
+      std::size_t begin;
+      std::size_t end;
+      {
+        std::lock_guard lock(victim.mutex);
+        if (victim.begin == victim.end) {
+          continue;
+        }
+        begin = victim.begin + (victim.end - victim.begin) / 2;
+        end = std::exchange(victim.end, begin);
+      }
+      std::lock_guard lock(ranges[self].mutex);
+      ranges[self].begin = begin + 1;
+      ranges[self].end = end;
+      return begin;
+    }
+    return std::nullopt;
+  };
+
+  bounded_queue<std::string> pending(options.queue_depth);
+  buffer_pool buffers;
+  std::atomic<std::size_t> failed = 0;
+  std::atomic<std::size_t> running = jobs;
+  std::atomic<bool> stop = false;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+
+  auto work = [&](std::size_t self) {
+    // Structures of one file are released wholesale by the next parse, the
+    // pool keeps their blocks for it.
+    std::pmr::unsynchronized_pool_resource pool;
+    smbios_parser parser(&pool);
+    parser.threads = 1;
+    dump_file_source source("");
+    try {
+      for (auto i = next_file(self); i && !stop; i = next_file(self)) {
+        std::string message;
+        try {
+          source.path = files[*i].string();
+          parser.parse(source);
+        } catch (const std::exception& e) {
+          message = e.what();
+          ++failed;
+        }
+        auto buffer = buffers.take();
+        serialize({files[*i], parser, message}, buffer);
+        pending.push(std::move(buffer));
+      }
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      stop = true;
+    }
+    if (--running == 0) {
+      pending.close();
+    }
+  };
+
+  {
+    std::vector<std::jthread> workers;
+    try {
+      for (std::size_t i = 0; i < jobs; ++i) {
+        workers.emplace_back(work, i);
+      }
+    } catch (const std::system_error&) {
+      // Workers that failed to start leave their files to be stolen.
+      if (workers.empty()) {
+        throw;
+      }
+      auto missing = jobs - workers.size();
+      if (running.fetch_sub(missing) == missing) {
+        pending.close();
+      }
+    }
+
+    // The calling thread is the writer.
+    std::string buffer;
+    while (pending.pop(buffer)) {
+      out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      buffers.give(std::move(buffer));
+    }
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  result.failed = failed;
+  return result;
+}
@@ -0,0 +1,54 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_BATCH_HPP
+#define SMBIOS_SMBIOS_BATCH_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "smbios_parser.hpp"
+
+struct batch_options {
+  // Worker threads, 0 for one per hardware thread.
+  unsigned jobs = 0;
+  // Serialized records waiting for the writer before workers block.
+  std::size_t queue_depth = 256;
+};
+
+struct batch_record {
+  const std::filesystem::path& path;
+  // The worker's parser, holding whatever was decoded before a failure.
+  const smbios_parser& parser;
+  // what() of the failure, empty when the dump parsed.
+  std::string_view error;
+};
+
+// Appends the representation of one dump to `out`. Called concurrently from
+// every worker.
+using batch_serializer = std::function<void(const batch_record& record, std::string& out)>;
+
+struct batch_result {
+  std::size_t files = 0;
+  std::size_t failed = 0;
+};
+
+// Regular files in `directory`, sorted by name.
+std::vector<std::filesystem::path> batch_files(const std::filesystem::path& directory);
+
+// Parses every `dmidecode --dump-bin` image in `files` on a work-stealing
+// pool and writes what `serialize` produced for each to `out`, in completion
+// order. A worker reuses its read buffer, parser and memory pool from one
+// file to the next. Rethrows the first exception thrown by `serialize`.
+batch_result parse_batch(std::span<const std::filesystem::path> files, const batch_serializer& serialize,
+                         std::ostream& out, const batch_options& options = {});
+
+
+#endif //SMBIOS_SMBIOS_BATCH_HPP
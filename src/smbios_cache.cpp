@@ -0,0 +1,419 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_cache.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#ifdef WIN32
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "smbios_fields.hpp"
+#include "smbios_parser.hpp"
+
+uint64_t smbios_table_digest(std::span<const std::byte> entry_point, std::span<const std::byte> table) {
+  // Eight bytes per multiply, a DMI table digests in about a microsecond.
+  constexpr uint64_t k = 0xFF51AFD7ED558CCD;
+  uint64_t h = 0x9E3779B97F4A7C15 ^ uint64_t{entry_point.size()} << 32 ^ table.size();
+  auto mix = [&](std::span<const std::byte> bytes) {
+    std::size_t i = 0;
+    for (; i + 8 <= bytes.size(); i += 8) {
+      uint64_t word;
+      std::memcpy(&word, bytes.data() + i, 8);
+      h = (h ^ word) * k;
+      h ^= h >> 32;
+    }
+    if (i < bytes.size()) {
+      uint64_t tail = 0;
+      std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+      h = (h ^ tail) * k;
+      h ^= h >> 32;
+    }
+  };
+  mix(entry_point);
+  mix(table);
+  return h;
+}
+
+// Appends "name/size," for each member, recursing into nested records.
+struct layout_describer {
+  std::string& out;
+
+  template<typename T>
+  void operator()(const char* name, const T&) {
+    out += name;
+    out += '/';
+    out += std::to_string(sizeof(T));
+    out += ',';
+    if constexpr (requires { typename T::value_type; } && !std::is_same_v<T, smbios_string>) {
+      if constexpr (smbios_described<typename T::value_type>) {
+        typename T::value_type element{};
+        smbios_fields(element, *this);
+      }
+    }
+  }
+};
+
+template<typename... Ts>
+static std::string describe_layout(smbios_type_list<Ts...>) {
+  std::string out;
+  layout_describer describer{out};
+  auto describe = [&]<typename T>(const T& s) {
+    out += std::to_string(sizeof(T));
+    out += '{';
+    smbios_fields(s, describer);
+    out += '}';
+  };
+  (describe(Ts()), ...);
+  describe(unknown_struct());
+  return out;
+}
+
+uint64_t smbios_cache_layout() {
+  static const uint64_t layout = [] {
+    auto description = describe_layout(smbios_types{});
+    return smbios_table_digest({}, std::as_bytes(std::span(description)));
+  }();
+  return layout;
+}
+
+// Serializes members in the cache encoding.
+class cache_writer {
+  std::vector<uint8_t>& out;
+  std::string_view table;
+
+public:
+  // Structure being written, its strings are located in it.
+  std::string_view structure;
+  // Set when a string is not in the structure, the file is then not written.
+  bool failed = false;
+
+  cache_writer(std::vector<uint8_t>& out, std::span<const std::byte> table) :
+    out(out),
+    table(reinterpret_cast<const char*>(table.data()), table.size()) {
+  }
+
+  void put(const void* bytes, std::size_t size) {
+    auto p = static_cast<const uint8_t*>(bytes);
+    out.insert(out.end(), p, p + size);
+  }
+
+  template<typename T> requires std::is_trivially_copyable_v<T>
+  void put(const T& value) {
+    put(&value, sizeof(T));
+  }
+
+  template<typename T>
+  void operator()(const char*, const T& member) {
+    write(member);
+  }
+
+  template<typename T>
+  void write(const T& member) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_array_v<T>) {
+      put(member);
+    } else if constexpr (std::is_same_v<T, smbios_string>) {
+      // Decoded strings are slices of the structure's string set.
+      std::string_view s = member;
+      auto pos = s.empty() ? 0 : structure.find(s);
+      if (pos == std::string_view::npos) {
+        failed = true;
+        return;
+      }
+      put(static_cast<uint32_t>(s.empty() ? 0 : structure.data() - table.data() + pos));
+      put(static_cast<uint32_t>(s.size()));
+    } else if constexpr (smbios_packed_field<T>) {
+      put(member.value);
+    } else if constexpr (smbios_described<T>) {
+      smbios_fields(member, *this);
+    } else {
+      put(static_cast<uint32_t>(member.size()));
+      if constexpr (std::is_arithmetic_v<typename T::value_type>) {
+        put(member.data(), member.size() * sizeof(typename T::value_type));
+      } else {
+        for (const auto& element : member) {
+          write(element);
+        }
+      }
+    }
+  }
+};
+
+// Restores members from the cache encoding. A read past the end yields zero
+// and sets `failed`.
+class cache_reader {
+  std::span<const std::byte> in;
+  std::size_t position = 0;
+  std::span<const std::byte> table;
+
+public:
+  bool failed = false;
+
+  cache_reader(std::span<const std::byte> in, std::span<const std::byte> table) : in(in), table(table) {
+  }
+
+  [[nodiscard]] std::size_t remaining() const {
+    return in.size() - position;
+  }
+
+  std::span<const std::byte> take(std::size_t size) {
+    if (size > remaining()) {
+      failed = true;
+      position = in.size();
+      return {};
+    }
+    auto bytes = in.subspan(position, size);
+    position += size;
+    return bytes;
+  }
+
+  template<typename T> requires std::is_trivially_copyable_v<T>
+  T get() {
+    T value{};
+    auto bytes = take(sizeof(T));
+    if (!bytes.empty()) {
+      std::memcpy(&value, bytes.data(), sizeof(T));
+    }
+    return value;
+  }
+
+  template<typename T>
+  void operator()(const char*, T& member) {
+    read(member);
+  }
+
+  template<typename T>
+  void read(T& member) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+      member = get<T>();
+    } else if constexpr (std::is_array_v<T>) {
+      auto bytes = take(sizeof(T));
+      if (!bytes.empty()) {
+        std::memcpy(&member, bytes.data(), sizeof(T));
+      }
+    } else if constexpr (std::is_same_v<T, smbios_string>) {
+      auto offset = get<uint32_t>();
+      auto size = get<uint32_t>();
+      if (offset > table.size() || size > table.size() - offset) {
+        failed = true;
+        return;
+      }
+      member = std::string_view(reinterpret_cast<const char*>(table.data()) + offset, size);
+    } else if constexpr (smbios_packed_field<T>) {
+      member = get<decltype(member.value)>();
+    } else if constexpr (smbios_described<T>) {
+      smbios_fields(member, *this);
+    } else {
+      using E = typename T::value_type;
+      auto count = get<uint32_t>();
+      // Every element takes at least a byte, so a damaged count fails here
+      // instead of reserving gigabytes.
+      if (count > remaining()) {
+        failed = true;
+        return;
+      }
+      if constexpr (std::is_arithmetic_v<E>) {
+        auto bytes = take(count * sizeof(E));
+        member.resize(bytes.size() / sizeof(E));
+        if (!bytes.empty()) {
+          std::memcpy(member.data(), bytes.data(), bytes.size());
+        }
+      } else {
+        member.reserve(count);
+        for (uint32_t i = 0; i < count && !failed; ++i) {
+          if constexpr (std::is_base_of_v<smbios, E>) {
+            read(member.emplace_back(member.get_allocator().resource()));
+          } else {
+            read(member.emplace_back());
+          }
+        }
+      }
+    }
+  }
+};
+
+using structure_restorer = void (*)(smbios_variant& slot, std::span<const std::byte> bytes, cache_reader& in,
+                                    std::pmr::memory_resource* resource);
+
+template<typename T>
+void restore_structure(smbios_variant& slot, std::span<const std::byte> bytes, cache_reader& in,
+                       std::pmr::memory_resource* resource) {
+  auto& s = slot.emplace<T>(resource);
+  bios_reader reader(bytes);
+  s.header.read(reader);
+  smbios_fields(s, in);
+}
+
+template<typename... Ts>
+constexpr auto make_structure_restorers(smbios_type_list<Ts...>) {
+  std::array<structure_restorer, 256> restorers{};
+  restorers.fill(&restore_structure<unknown_struct>);
+  ((restorers[static_cast<uint8_t>(Ts::TYPE)] = &restore_structure<Ts>), ...);
+  return restorers;
+}
+
+// Indexed by the structure type byte, like the decoders.
+constexpr auto structure_restorers = make_structure_restorers(smbios_types{});
+
+#ifdef WIN32
+
+static bool load_cache_file(const std::string& path, table_buffer& file) {
+  try {
+    file.load(path.c_str());
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  return true;
+}
+
+static void save_cache_file(const std::string& path, std::span<const uint8_t> bytes) {
+  auto temp = path + ".tmp";
+  {
+    std::ofstream file(temp, std::ios_base::binary | std::ios_base::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file.flush()) {
+      return;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp, path, ec);
+}
+
+#else
+
+static bool load_cache_file(const std::string& path, table_buffer& file) {
+  // Only a file this user wrote and no one else can rewrite is trusted.
+  struct stat st{};
+  if (::stat(path.c_str(), &st) != 0 || st.st_uid != ::geteuid() || (st.st_mode & (S_IWGRP | S_IWOTH))) {
+    return false;
+  }
+  try {
+    file.load(path.c_str());
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  return true;
+}
+
+static void save_cache_file(const std::string& path, std::span<const uint8_t> bytes) {
+  // mkostemp creates the file 0600. Renamed over the old one once complete,
+  // so a concurrent reader sees either file whole.
+  auto temp = path + ".XXXXXX";
+  int fd = ::mkostemp(temp.data(), O_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+  std::size_t total = 0;
+  while (total < bytes.size()) {
+    auto n = ::write(fd, bytes.data() + total, bytes.size() - total);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    total += static_cast<std::size_t>(n);
+  }
+  bool written = ::close(fd) == 0 && total == bytes.size();
+  if (!written || ::rename(temp.c_str(), path.c_str()) != 0) {
+    ::unlink(temp.c_str());
+  }
+}
+
+#endif
+
+bool smbios_parser::restore_cache(std::span<const std::byte> entry_point_bytes) {
+  table_buffer file;
+  if (!load_cache_file(cache_path, file) || file.size() < sizeof(parse_cache_header)) {
+    return false;
+  }
+  parse_cache_header header;
+  std::memcpy(&header, file.data(), sizeof(header));
+  auto bytes = table.bytes();
+  if (header.magic != parse_cache_header::MAGIC || header.format != parse_cache_header::FORMAT ||
+      header.layout != smbios_cache_layout() || header.types != types || header.table_size != bytes.size() ||
+      header.entry_point_size != entry_point_bytes.size()) {
+    return false;
+  }
+  cache_reader in(file.bytes().subspan(sizeof(header)), bytes);
+  auto cached_entry_point = in.take(header.entry_point_size);
+  if (in.failed || !std::ranges::equal(cached_entry_point, entry_point_bytes) ||
+      header.digest != smbios_table_digest(entry_point_bytes, bytes) ||
+      header.structure_count > in.remaining() / (2 * sizeof(uint32_t))) {
+    return false;
+  }
+
+  read_entry_point_bytes(entry_point_bytes);
+  storage.resize(header.structure_count);
+  bounds.resize(header.structure_count);
+  for (std::size_t i = 0; i < storage.size() && !in.failed; ++i) {
+    auto offset = in.get<uint32_t>();
+    auto size = in.get<uint32_t>();
+    if (offset >= bytes.size() || size < 4 || size > bytes.size() - offset) {
+      in.failed = true;
+      break;
+    }
+    bounds[i] = {offset, size};
+    structure_restorers[static_cast<uint8_t>(bytes[offset])](storage[i], bytes.subspan(offset, size), in, resource());
+  }
+  if (in.failed || in.remaining() != 0) {
+    delete entry_point;
+    entry_point = nullptr;
+    version = 0;
+    storage.clear();
+    bounds.clear();
+    return false;
+  }
+  build_indexes();
+  return true;
+}
+
+void smbios_parser::write_cache(std::span<const std::byte> entry_point_bytes) {
+  try {
+    decode_all();
+  } catch (const std::exception&) {
+    return;
+  }
+  auto bytes = table.bytes();
+  parse_cache_header header;
+  header.layout = smbios_cache_layout();
+  header.digest = smbios_table_digest(entry_point_bytes, bytes);
+  header.table_size = bytes.size();
+  header.types = types;
+  header.entry_point_size = static_cast<uint32_t>(entry_point_bytes.size());
+  header.structure_count = static_cast<uint32_t>(storage.size());
+
+  std::vector<uint8_t> out;
+  cache_writer writer(out, bytes);
+  writer.put(header);
+  writer.put(entry_point_bytes.data(), entry_point_bytes.size());
+  for (std::size_t i = 0; i < storage.size() && !writer.failed; ++i) {
+    writer.put(static_cast<uint32_t>(bounds[i].offset));
+    writer.put(static_cast<uint32_t>(bounds[i].size));
+    writer.structure = {reinterpret_cast<const char*>(bytes.data()) + bounds[i].offset, bounds[i].size};
+    std::visit([&](const auto& s) { smbios_fields(s, writer); }, storage[i]);
+  }
+  if (!writer.failed) {
+    save_cache_file(cache_path, out);
+  }
+}
@@ -0,0 +1,43 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_CACHE_HPP
+#define SMBIOS_SMBIOS_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "smbios.hpp"
+
+// Layout of the file smbios_parser::cache_path names, in native byte order as
+// it never leaves the host that wrote it: this header, the entry point bytes,
+// then per structure its offset and size in the table followed by its members
+// in smbios_fields order. Strings are stored as offset and length into the
+// table, which `digest` ties the file to.
+struct parse_cache_header {
+  static constexpr uint32_t MAGIC = 0x43424D53; // "SMBC"
+  static constexpr uint32_t FORMAT = 1;
+
+  uint32_t magic = MAGIC;
+  uint32_t format = FORMAT;
+  // smbios_cache_layout() of the writer, differs once smbios_fields does.
+  uint64_t layout{};
+  uint64_t digest{};
+  uint64_t table_size{};
+  // smbios_parser::types the structures were kept with.
+  smbios_type_mask types;
+  uint32_t entry_point_size{};
+  uint32_t structure_count{};
+};
+
+// 64-bit digest of the raw entry point and structure table, what a parse
+// cache is keyed by. Detects changed tables, it is not a cryptographic hash.
+uint64_t smbios_table_digest(std::span<const std::byte> entry_point, std::span<const std::byte> table);
+
+// Digest of every structure class's member names and sizes.
+uint64_t smbios_cache_layout();
+
+
+#endif //SMBIOS_SMBIOS_CACHE_HPP
@@ -0,0 +1,410 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_FIELDS_HPP
+#define SMBIOS_SMBIOS_FIELDS_HPP
+
+#include <concepts>
+#include <type_traits>
+
+#include "smbios.hpp"
+
+// smbios_fields(s, f) calls f(name, member) for every decoded member of s in
+// declaration order, the header excluded. S is the structure class, const or
+// not, so one description serves code that reads fields and code that
+// restores them.
+
+// Bit-field members such as cpu_status: `value` holds the raw field and
+// assigning it decodes the rest. They are described too, `value` first.
+template<typename T>
+concept smbios_packed_field = requires(T t) {
+  t.value;
+  t = t.value;
+};
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, cpu_status>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("status", s.status);
+  f("socket", s.socket);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, cache_configuration>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("level", s.level);
+  f("socket", s.socket);
+  f("location", s.location);
+  f("state", s.state);
+  f("operational_mode", s.operational_mode);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, cache_size>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("size", s.size);
+  f("granularity", s.granularity);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, cache_size2>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("size", s.size);
+  f("granularity", s.granularity);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_device_attributes>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("rank", s.rank);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_device_extended_size>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("size", s.size);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_device_extended_speed>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("speed", s.speed);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, onboard_device_type>
+void smbios_fields(S& s, F&& f) {
+  f("value", s.value);
+  f("status", s.status);
+  f("type", s.type);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, bios_info>
+void smbios_fields(S& s, F&& f) {
+  f("vendor", s.vendor);
+  f("bios_version", s.bios_version);
+  f("bios_starting_addr_seg", s.bios_starting_addr_seg);
+  f("bios_release_date", s.bios_release_date);
+  f("bios_rom_size", s.bios_rom_size);
+  f("bios_characteristics", s.bios_characteristics);
+  f("bios_characteristics_ext_byte1", s.bios_characteristics_ext_byte1);
+  f("bios_characteristics_ext_byte2", s.bios_characteristics_ext_byte2);
+  f("system_bios_major_release", s.system_bios_major_release);
+  f("system_bios_minor_release", s.system_bios_minor_release);
+  f("embedded_controller_firmware_major_release", s.embedded_controller_firmware_major_release);
+  f("embedded_controller_firmware_minor_release", s.embedded_controller_firmware_minor_release);
+  f("extended_bios_rom_size", s.extended_bios_rom_size);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, system_info>
+void smbios_fields(S& s, F&& f) {
+  f("manufacturer", s.manufacturer);
+  f("product_name", s.product_name);
+  f("version", s.version);
+  f("serial_number", s.serial_number);
+  f("uuid", s.uuid);
+  f("wake_up_type", s.wake_up_type);
+  f("sku_number", s.sku_number);
+  f("family", s.family);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, baseboard_info>
+void smbios_fields(S& s, F&& f) {
+  f("manufacturer", s.manufacturer);
+  f("product", s.product);
+  f("version", s.version);
+  f("serial_number", s.serial_number);
+  f("asset_tag", s.asset_tag);
+  f("feature_flags", s.feature_flags);
+  f("location_in_chassis", s.location_in_chassis);
+  f("chassis_handle", s.chassis_handle);
+  f("board_type", s.board_type);
+  f("num_of_contained_object_handles", s.num_of_contained_object_handles);
+  f("contained_object_handles", s.contained_object_handles);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, system_enclosure>
+void smbios_fields(S& s, F&& f) {
+  f("manufacturer", s.manufacturer);
+  f("type", s.type);
+  f("version", s.version);
+  f("serial_number", s.serial_number);
+  f("asset_tag_number", s.asset_tag_number);
+  f("boot_up_state", s.boot_up_state);
+  f("power_supply_state", s.power_supply_state);
+  f("thermal_state", s.thermal_state);
+  f("security_status", s.security_status);
+  f("oem_defined", s.oem_defined);
+  f("height", s.height);
+  f("num_of_power_cords", s.num_of_power_cords);
+  f("contained_element_count", s.contained_element_count);
+  f("contained_element_record_length", s.contained_element_record_length);
+  f("contained_elements", s.contained_elements);
+  f("sku_number", s.sku_number);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, processor_info>
+void smbios_fields(S& s, F&& f) {
+  f("socket_designation", s.socket_designation);
+  f("processor_type", s.processor_type);
+  f("processor_family", s.processor_family);
+  f("processor_manufacturer", s.processor_manufacturer);
+  f("processor_id", s.processor_id);
+  f("processor_version", s.processor_version);
+  f("voltage", s.voltage);
+  f("external_clock", s.external_clock);
+  f("max_speed", s.max_speed);
+  f("current_speed", s.current_speed);
+  f("status", s.status);
+  f("processor_upgrade", s.processor_upgrade);
+  f("l1_cache_handle", s.l1_cache_handle);
+  f("l2_cache_handle", s.l2_cache_handle);
+  f("l3_cache_handle", s.l3_cache_handle);
+  f("serial_number", s.serial_number);
+  f("asset_tag", s.asset_tag);
+  f("part_number", s.part_number);
+  f("core_count", s.core_count);
+  f("core_enabled", s.core_enabled);
+  f("thread_count", s.thread_count);
+  f("processor_characteristics", s.processor_characteristics);
+  f("processor_family_2", s.processor_family_2);
+  f("core_count_2", s.core_count_2);
+  f("core_enabled_2", s.core_enabled_2);
+  f("thread_count_2", s.thread_count_2);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, cache_info>
+void smbios_fields(S& s, F&& f) {
+  f("socket_designation", s.socket_designation);
+  f("cache_configuration", s.cache_configuration);
+  f("max_cache_size", s.max_cache_size);
+  f("installed_size", s.installed_size);
+  f("supported_sram_type", s.supported_sram_type);
+  f("current_sram_type", s.current_sram_type);
+  f("cache_speed", s.cache_speed);
+  f("error_correction_type", s.error_correction_type);
+  f("system_cache_type", s.system_cache_type);
+  f("associativity", s.associativity);
+  f("max_cache_size2", s.max_cache_size2);
+  f("installed_cache_size2", s.installed_cache_size2);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, port_connector_info>
+void smbios_fields(S& s, F&& f) {
+  f("internal_ref_designator", s.internal_ref_designator);
+  f("internal_connector_type", s.internal_connector_type);
+  f("external_ref_designator", s.external_ref_designator);
+  f("external_connector_type", s.external_connector_type);
+  f("port_type", s.port_type);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, oem_strings>
+void smbios_fields(S& s, F&& f) {
+  f("strings", s.strings);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, system_configuration_options>
+void smbios_fields(S& s, F&& f) {
+  f("strings", s.strings);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, physical_memory_array>
+void smbios_fields(S& s, F&& f) {
+  f("location", s.location);
+  f("use", s.use);
+  f("memory_error_correction", s.memory_error_correction);
+  f("max_capacity", s.max_capacity);
+  f("memory_err_info_handle", s.memory_err_info_handle);
+  f("num_of_memory_device", s.num_of_memory_device);
+  f("extended_max_capacity", s.extended_max_capacity);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_error_info>
+void smbios_fields(S& s, F&& f) {
+  f("error_type", s.error_type);
+  f("error_granularity", s.error_granularity);
+  f("error_operation", s.error_operation);
+  f("vendor_syndrome", s.vendor_syndrome);
+  f("memory_array_error_address", s.memory_array_error_address);
+  f("device_error_address", s.device_error_address);
+  f("error_resolution", s.error_resolution);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_array_mapped_address>
+void smbios_fields(S& s, F&& f) {
+  f("starting_address", s.starting_address);
+  f("ending_address", s.ending_address);
+  f("memory_array_handle", s.memory_array_handle);
+  f("partition_width", s.partition_width);
+  f("extended_starting_address", s.extended_starting_address);
+  f("extended_ending_address", s.extended_ending_address);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, system_boot_info>
+void smbios_fields(S& s, F&& f) {
+  f("reserved", s.reserved);
+  f("boot_status", s.boot_status);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, tpm_device>
+void smbios_fields(S& s, F&& f) {
+  f("vendor_id", s.vendor_id);
+  f("major_spec_version", s.major_spec_version);
+  f("minor_spec_version", s.minor_spec_version);
+  f("firmware_version1", s.firmware_version1);
+  f("firmware_version2", s.firmware_version2);
+  f("description", s.description);
+  f("characteristics", s.characteristics);
+  f("oem_defined", s.oem_defined);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_device>
+void smbios_fields(S& s, F&& f) {
+  f("physical_memory_array_handle", s.physical_memory_array_handle);
+  f("memory_error_info_handle", s.memory_error_info_handle);
+  f("total_width", s.total_width);
+  f("data_width", s.data_width);
+  f("size", s.size);
+  f("form_factor", s.form_factor);
+  f("device_set", s.device_set);
+  f("device_locator", s.device_locator);
+  f("bank_locator", s.bank_locator);
+  f("memory_type", s.memory_type);
+  f("type_detail", s.type_detail);
+  f("speed", s.speed);
+  f("manufacturer", s.manufacturer);
+  f("serial_number", s.serial_number);
+  f("asset_tag", s.asset_tag);
+  f("part_number", s.part_number);
+  f("attributes", s.attributes);
+  f("extended_size", s.extended_size);
+  f("configured_memory_speed", s.configured_memory_speed);
+  f("min_voltage", s.min_voltage);
+  f("max_voltage", s.max_voltage);
+  f("configured_voltage", s.configured_voltage);
+  f("memory_technology", s.memory_technology);
+  f("memory_operating_mode_capability", s.memory_operating_mode_capability);
+  f("firmware_version", s.firmware_version);
+  f("module_manufacturer_id", s.module_manufacturer_id);
+  f("module_product_id", s.module_product_id);
+  f("memory_subsystem_controller_manufacturer_id", s.memory_subsystem_controller_manufacturer_id);
+  f("memory_subsystem_controller_product_id", s.memory_subsystem_controller_product_id);
+  f("non_volatile_size", s.non_volatile_size);
+  f("volatile_size", s.volatile_size);
+  f("cache_size", s.cache_size);
+  f("logical_size", s.logical_size);
+  f("extended_speed", s.extended_speed);
+  f("extended_configured_memory_speed", s.extended_configured_memory_speed);
+  f("pmic0_manufacturer_id", s.pmic0_manufacturer_id);
+  f("pmic0_revision_number", s.pmic0_revision_number);
+  f("rcd_manufacturer_id", s.rcd_manufacturer_id);
+  f("rcd_revision_number", s.rcd_revision_number);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, processor_additional_info>
+void smbios_fields(S& s, F&& f) {
+  f("referenced_handle", s.referenced_handle);
+  f("block_length", s.block_length);
+  f("processor_type", s.processor_type);
+  f("processor_specific_data", s.processor_specific_data);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, memory_device_mapped_address>
+void smbios_fields(S& s, F&& f) {
+  f("starting_address", s.starting_address);
+  f("ending_address", s.ending_address);
+  f("memory_device_handle", s.memory_device_handle);
+  f("memory_arr_mapped_addr_handle", s.memory_arr_mapped_addr_handle);
+  f("partition_row_position", s.partition_row_position);
+  f("interleave_position", s.interleave_position);
+  f("interleaved_data_depth", s.interleaved_data_depth);
+  f("extended_starting_address", s.extended_starting_address);
+  f("extended_ending_address", s.extended_ending_address);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, additional_info_entry>
+void smbios_fields(S& s, F&& f) {
+  f("entry_length", s.entry_length);
+  f("referenced_handle", s.referenced_handle);
+  f("referenced_offset", s.referenced_offset);
+  f("string", s.string);
+  f("value", s.value);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, additional_info>
+void smbios_fields(S& s, F&& f) {
+  f("num_of_additional_info_entries", s.num_of_additional_info_entries);
+  f("entries", s.entries);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, peer_device>
+void smbios_fields(S& s, F&& f) {
+  f("segment_group_number", s.segment_group_number);
+  f("bus_number", s.bus_number);
+  f("device_function_number", s.device_function_number);
+  f("data_bus_width", s.data_bus_width);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, system_slots>
+void smbios_fields(S& s, F&& f) {
+  f("slot_designation", s.slot_designation);
+  f("slot_type", s.slot_type);
+  f("slot_data_bus_width", s.slot_data_bus_width);
+  f("current_usage", s.current_usage);
+  f("slot_length", s.slot_length);
+  f("slot_id", s.slot_id);
+  f("slot_characteristics1", s.slot_characteristics1);
+  f("slot_characteristics2", s.slot_characteristics2);
+  f("segment_group_number", s.segment_group_number);
+  f("bus_number", s.bus_number);
+  f("device_function_number", s.device_function_number);
+  f("data_bus_width", s.data_bus_width);
+  f("peer_grouping_count", s.peer_grouping_count);
+  f("peer_groups", s.peer_groups);
+  f("slot_info", s.slot_info);
+  f("slot_physical_width", s.slot_physical_width);
+  f("slot_pitch", s.slot_pitch);
+  f("slot_height", s.slot_height);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, onboard_devices_extended_info>
+void smbios_fields(S& s, F&& f) {
+  f("reference_designation", s.reference_designation);
+  f("device_type", s.device_type);
+  f("device_type_instance", s.device_type_instance);
+  f("segment_group_number", s.segment_group_number);
+  f("bus_number", s.bus_number);
+  f("device_function_number", s.device_function_number);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, firmware_inventory_info>
+void smbios_fields(S& s, F&& f) {
+  f("firmware_component_name", s.firmware_component_name);
+  f("firmware_version", s.firmware_version);
+  f("version_format", s.version_format);
+  f("firmware_id", s.firmware_id);
+  f("firmware_id_format", s.firmware_id_format);
+  f("release_date", s.release_date);
+  f("manufacturer", s.manufacturer);
+  f("lowest_supported_firmware_version", s.lowest_supported_firmware_version);
+  f("image_size", s.image_size);
+  f("characteristics", s.characteristics);
+  f("state", s.state);
+  f("num_of_associated_components", s.num_of_associated_components);
+  f("associated_component_handles", s.associated_component_handles);
+}
+
+template<typename S, typename F> requires std::same_as<std::remove_const_t<S>, unknown_struct>
+void smbios_fields(S& s, F&& f) {
+  f("data", s.data);
+}
+
+// Classes smbios_fields describes, including the bit-field members and the
+// records nested in additional_info and system_slots.
+template<typename T>
+concept smbios_described = requires(T& t) {
+  smbios_fields(t, [](const char*, auto&) {});
+};
+
+
+#endif //SMBIOS_SMBIOS_FIELDS_HPP
@@ -0,0 +1,86 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_format.hpp"
+#include <array>
+#include <system_error>
+
+#include "smbios.hpp"
+
+// Both digits of every byte value, so a byte is one two-character copy.
+static constexpr auto make_hex_pairs(const char* digits) {
+  std::array<char, 512> pairs{};
+  for (std::size_t b = 0; b < 256; ++b) {
+    pairs[2 * b] = digits[b >> 4];
+    pairs[2 * b + 1] = digits[b & 0xF];
+  }
+  return pairs;
+}
+
+static constexpr auto upper_hex = make_hex_pairs("0123456789ABCDEF");
+static constexpr auto lower_hex = make_hex_pairs("0123456789abcdef");
+
+static char* put_hex(char* out, uint8_t byte, const std::array<char, 512>& pairs) {
+  out[0] = pairs[2 * byte];
+  out[1] = pairs[2 * byte + 1];
+  return out + 2;
+}
+
+static std::to_chars_result too_large(char* last) {
+  return {last, std::errc::value_too_large};
+}
+
+std::to_chars_result format_uuid(char* first, char* last, const uint8_t (&uuid)[16], uint32_t version) {
+  if (last - first < static_cast<std::ptrdiff_t>(uuid_chars)) {
+    return too_large(last);
+  }
+  static constexpr uint8_t stored_order[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  static constexpr uint8_t mixed_endian[16] = {3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15};
+  const auto& order = version >= static_cast<uint32_t>(smbios_version::smbios_2_6) ? mixed_endian : stored_order;
+  for (int i = 0; i < 16; ++i) {
+    if (i == 4 || i == 6 || i == 8 || i == 10) {
+      *first++ = '-';
+    }
+    first = put_hex(first, uuid[order[i]], lower_hex);
+  }
+  return {first, std::errc()};
+}
+
+std::to_chars_result format_handle(char* first, char* last, uint16_t handle) {
+  if (last - first < static_cast<std::ptrdiff_t>(handle_chars)) {
+    return too_large(last);
+  }
+  *first++ = '0';
+  *first++ = 'x';
+  first = put_hex(first, handle >> 8, upper_hex);
+  first = put_hex(first, handle & 0xFF, upper_hex);
+  return {first, std::errc()};
+}
+
+std::to_chars_result format_processor_id(char* first, char* last, uint64_t processor_id) {
+  if (last - first < static_cast<std::ptrdiff_t>(processor_id_chars)) {
+    return too_large(last);
+  }
+  // Decoded little-endian, so the low byte came first in the table.
+  for (int i = 0; i < 8; ++i) {
+    if (i) {
+      *first++ = ' ';
+    }
+    first = put_hex(first, processor_id >> (8 * i) & 0xFF, upper_hex);
+  }
+  return {first, std::errc()};
+}
+
+std::to_chars_result format_hex(char* first, char* last, std::span<const uint8_t> bytes, char separator) {
+  if (static_cast<std::size_t>(last - first) < hex_chars(bytes.size(), separator)) {
+    return too_large(last);
+  }
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    if (separator && i) {
+      *first++ = separator;
+    }
+    first = put_hex(first, bytes[i], upper_hex);
+  }
+  return {first, std::errc()};
+}
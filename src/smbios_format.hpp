@@ -0,0 +1,44 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_FORMAT_HPP
+#define SMBIOS_SMBIOS_FORMAT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Identifier formatting into caller buffers, never allocating. Like
+// std::to_chars each writes into [first, last) and returns the end of the
+// text, or `last` and std::errc::value_too_large when it does not fit. No NUL
+// is appended.
+
+// Characters each formatter writes.
+constexpr std::size_t uuid_chars = 36;
+constexpr std::size_t handle_chars = 6;
+constexpr std::size_t processor_id_chars = 23;
+
+// Canonical lowercase 8-4-4-4-12 form. From SMBIOS 2.6 on the first three
+// fields are stored little-endian and are swapped into RFC 4122 order, earlier
+// tables are printed in stored order.
+std::to_chars_result format_uuid(char* first, char* last, const uint8_t (&uuid)[16], uint32_t version);
+
+// "0x002A".
+std::to_chars_result format_handle(char* first, char* last, uint16_t handle);
+
+// processor_info::processor_id as its eight bytes in table order, the way
+// dmidecode prints it: "A6 06 06 00 FF FB EB BF".
+std::to_chars_result format_processor_id(char* first, char* last, uint64_t processor_id);
+
+// Two uppercase digits per byte, `separator` between bytes unless it is '\0'.
+std::to_chars_result format_hex(char* first, char* last, std::span<const uint8_t> bytes, char separator = '\0');
+
+// Characters format_hex writes for `size` bytes.
+constexpr std::size_t hex_chars(std::size_t size, char separator = '\0') {
+  return size == 0 ? 0 : size * 2 + (separator ? size - 1 : 0);
+}
+
+
+#endif //SMBIOS_SMBIOS_FORMAT_HPP
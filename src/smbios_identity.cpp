@@ -0,0 +1,112 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_identity.hpp"
+#include <algorithm>
+#include <array>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+#include "basic_smbios_parser.hpp"
+#include "smbios_format.hpp"
+
+struct identity_field {
+  const char* file;
+  std::string smbios_identity::* member;
+};
+
+constexpr identity_field identity_fields[] = {
+  {"sys_vendor", &smbios_identity::vendor},
+  {"product_name", &smbios_identity::product_name},
+  {"product_version", &smbios_identity::product_version},
+  {"product_serial", &smbios_identity::serial_number},
+  {"product_uuid", &smbios_identity::uuid},
+  {"board_vendor", &smbios_identity::board_vendor},
+  {"board_name", &smbios_identity::board_name},
+  {"board_version", &smbios_identity::board_version},
+  {"board_serial", &smbios_identity::board_serial},
+};
+
+constexpr std::size_t identity_field_count = std::size(identity_fields);
+
+// Linux treats strings of only spaces as empty.
+static std::string identity_string(std::string_view s) {
+  return s.find_first_not_of(' ') == std::string_view::npos ? std::string() : std::string(s);
+}
+
+// Kernel `product_uuid` formatting, absent for the all-0x00 and all-0xFF
+// placeholders.
+static std::string identity_uuid(const uint8_t (&uuid)[16], uint32_t version) {
+  if (std::ranges::all_of(uuid, [](uint8_t b) { return b == 0x00; }) ||
+      std::ranges::all_of(uuid, [](uint8_t b) { return b == 0xFF; })) {
+    return {};
+  }
+  char text[uuid_chars];
+  auto result = format_uuid(text, text + uuid_chars, uuid, version);
+  return {text, result.ptr};
+}
+
+template<typename Parser>
+static smbios_identity identity_from(const Parser& parser) {
+  smbios_identity identity;
+  if (auto sys = parser.template find<system_info>()) {
+    identity.vendor = identity_string(sys->manufacturer);
+    identity.product_name = identity_string(sys->product_name);
+    identity.product_version = identity_string(sys->version);
+    identity.serial_number = identity_string(sys->serial_number);
+    identity.uuid = identity_uuid(sys->uuid, parser.version);
+  }
+  if (auto board = parser.template find<baseboard_info>()) {
+    identity.board_vendor = identity_string(board->manufacturer);
+    identity.board_name = identity_string(board->product);
+    identity.board_version = identity_string(board->version);
+    identity.board_serial = identity_string(board->serial_number);
+  }
+  return identity;
+}
+
+smbios_identity read_identity(const smbios_parser& parser) {
+  return identity_from(parser);
+}
+
+smbios_identity read_identity(const identity_options& options) {
+  smbios_identity identity;
+  std::array<bool, identity_field_count> present{};
+  bool complete = true;
+  for (std::size_t i = 0; i < identity_field_count; ++i) {
+    std::ifstream file(options.directory + "/" + identity_fields[i].file);
+    present[i] = file && std::getline(file, identity.*identity_fields[i].member);
+    complete = complete && present[i];
+  }
+  if (complete && !options.verify) {
+    return identity;
+  }
+
+  smbios_identity decoded;
+  try {
+    basic_smbios_parser<system_info, baseboard_info> parser;
+    parser.parse();
+    decoded = identity_from(parser);
+  } catch (const std::exception&) {
+    if (options.verify) {
+      throw;
+    }
+    return identity;
+  }
+
+  for (std::size_t i = 0; i < identity_field_count; ++i) {
+    auto& value = identity.*identity_fields[i].member;
+    const auto& table_value = decoded.*identity_fields[i].member;
+    if (!present[i]) {
+      value = table_value;
+    } else if (options.verify && value != table_value) {
+      throw std::runtime_error(std::format("identity mismatch, {}: \"{}\" in {}, \"{}\" in the table",
+                                           identity_fields[i].file, value, options.directory, table_value));
+    }
+  }
+  return identity;
+}
@@ -0,0 +1,47 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_IDENTITY_HPP
+#define SMBIOS_SMBIOS_IDENTITY_HPP
+
+#include <string>
+
+#include "smbios_parser.hpp"
+
+// The system_info and baseboard_info fields hosts are usually identified by,
+// in the form Linux shows them under /sys/class/dmi/id.
+struct smbios_identity {
+  std::string vendor;
+  std::string product_name;
+  std::string product_version;
+  std::string serial_number;
+  // Lowercase and dashed. The first three fields are little-endian from
+  // SMBIOS 2.6 on.
+  std::string uuid;
+  std::string board_vendor;
+  std::string board_name;
+  std::string board_version;
+  std::string board_serial;
+
+  bool operator==(const smbios_identity& other) const = default;
+};
+
+struct identity_options {
+  std::string directory = "/sys/class/dmi/id";
+  // Decodes the table as well and throws std::runtime_error when a field
+  // read from `directory` differs from it.
+  bool verify = false;
+};
+
+// Reads `directory` and decodes system_info and baseboard_info from the live
+// tables only for fields it does not have, e.g. the root-only serials
+// without root. When the tables can not be read either those fields stay
+// empty, unless verifying.
+smbios_identity read_identity(const identity_options& options = {});
+
+// Same fields from an already parsed table.
+smbios_identity read_identity(const smbios_parser& parser);
+
+
+#endif //SMBIOS_SMBIOS_IDENTITY_HPP
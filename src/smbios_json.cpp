@@ -0,0 +1,323 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_json.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "smbios_fields.hpp"
+#include "smbios_format.hpp"
+#include "smbios_names.hpp"
+
+template<typename T> requires std::is_integral_v<T>
+static void put_number(std::string& out, T value) {
+  char text[24];
+  auto result = std::to_chars(text, text + sizeof(text), value);
+  out.append(text, result.ptr);
+}
+
+// Length of the UTF-8 sequence starting at s[i], 0 when it is malformed,
+// overlong, a surrogate or above U+10FFFF.
+static std::size_t utf8_length(std::string_view s, std::size_t i) {
+  auto byte = [&](std::size_t k) { return static_cast<unsigned char>(s[i + k]); };
+  auto continuation = [&](std::size_t k) { return i + k < s.size() && (byte(k) & 0xC0) == 0x80; };
+  auto c = byte(0);
+  if (c >= 0xC2 && c <= 0xDF) {
+    return continuation(1) ? 2 : 0;
+  }
+  if (c >= 0xE0 && c <= 0xEF) {
+    if (!continuation(1) || !continuation(2) || (c == 0xE0 && byte(1) < 0xA0) || (c == 0xED && byte(1) > 0x9F)) {
+      return 0;
+    }
+    return 3;
+  }
+  if (c >= 0xF0 && c <= 0xF4) {
+    if (!continuation(1) || !continuation(2) || !continuation(3) || (c == 0xF0 && byte(1) < 0x90) ||
+        (c == 0xF4 && byte(1) > 0x8F)) {
+      return 0;
+    }
+    return 4;
+  }
+  return 0;
+}
+
+static void put_escape(std::string& out, unsigned char c) {
+  if (c == '"' || c == '\\') {
+    out += '\\';
+    out += static_cast<char>(c);
+  } else if (c == '\n') {
+    out += "\\n";
+  } else if (c == '\t') {
+    out += "\\t";
+  } else {
+    static constexpr char digits[] = "0123456789abcdef";
+    char text[6] = {'\\', 'u', '0', '0', digits[c >> 4], digits[c & 0xF]};
+    out.append(text, sizeof(text));
+  }
+}
+
+static void put_string(std::string& out, std::string_view s) {
+  out += '"';
+  // Runs of characters that need no escaping are appended at once.
+  std::size_t run = 0;
+  std::size_t i = 0;
+  while (i < s.size()) {
+    auto c = static_cast<unsigned char>(s[i]);
+    if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') {
+      ++i;
+      continue;
+    }
+    auto length = c >= 0x80 ? utf8_length(s, i) : 0;
+    if (length) {
+      i += length;
+      continue;
+    }
+    out.append(s.data() + run, i - run);
+    put_escape(out, c);
+    run = ++i;
+  }
+  out.append(s.data() + run, i - run);
+  out += '"';
+}
+
+static void put_hex(std::string& out, std::span<const uint8_t> bytes) {
+  out += '"';
+  auto size = out.size();
+  out.resize(size + hex_chars(bytes.size()));
+  format_hex(out.data() + size, out.data() + out.size(), bytes);
+  out += '"';
+}
+
+template<typename E>
+static void put_enum(std::string& out, E value) {
+  using U = std::underlying_type_t<E>;
+  auto bits = static_cast<U>(value);
+  if constexpr (smbios_flag_enum<E>) {
+    out += '[';
+    bool first = true;
+    for (auto rest = static_cast<std::make_unsigned_t<U>>(bits); rest; rest &= rest - 1) {
+      auto bit = static_cast<U>(decltype(rest){1} << std::countr_zero(rest));
+      out += first ? "" : ",";
+      first = false;
+      auto name = smbios_name(static_cast<E>(bit));
+      if (name.empty()) {
+        put_number(out, bit);
+      } else {
+        put_string(out, name);
+      }
+    }
+    out += ']';
+  } else if constexpr (requires { smbios_name(value); }) {
+    auto name = smbios_name(value);
+    if (name.empty()) {
+      put_number(out, bits);
+    } else {
+      put_string(out, name);
+    }
+  } else {
+    put_number(out, bits);
+  }
+}
+
+// Writes each member as `"name":value`, comma separated.
+struct json_members {
+  std::string& out;
+  uint32_t version;
+  bool first = true;
+
+  template<typename T>
+  void operator()(const char* name, const T& member) {
+    out += first ? "\"" : ",\"";
+    first = false;
+    out += name;
+    out += "\":";
+    if constexpr (std::is_same_v<T, uint8_t[16]>) {
+      // system_info::uuid, the only 16-byte array.
+      char text[uuid_chars];
+      out += '"';
+      out.append(text, format_uuid(text, text + uuid_chars, member, version).ptr);
+      out += '"';
+    } else {
+      put(member);
+    }
+  }
+
+  template<typename T>
+  void put(const T& member) {
+    if constexpr (std::is_enum_v<T>) {
+      put_enum(out, member);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      put_number(out, member);
+    } else if constexpr (std::is_array_v<T>) {
+      put_hex(out, member);
+    } else if constexpr (std::is_same_v<T, smbios_string>) {
+      put_string(out, member);
+    } else if constexpr (smbios_described<T>) {
+      out += '{';
+      json_members nested{out, version};
+      smbios_fields(member, nested);
+      out += '}';
+    } else if constexpr (std::is_same_v<typename T::value_type, uint8_t>) {
+      put_hex(out, member);
+    } else {
+      out += '[';
+      for (std::size_t i = 0; i < member.size(); ++i) {
+        out += i ? "," : "";
+        put(member[i]);
+      }
+      out += ']';
+    }
+  }
+};
+
+template<typename T>
+static void put_structure(std::string& out, const T& s, uint32_t version) {
+  out += "{\"header\":{\"type\":";
+  put_number(out, static_cast<uint8_t>(s.header.type));
+  if (auto name = smbios_name(s.header.type); !name.empty()) {
+    out += ",\"type_name\":";
+    put_string(out, name);
+  }
+  out += ",\"handle\":";
+  put_number(out, s.header.handle);
+  out += ",\"length\":";
+  put_number(out, s.header.length);
+  out += '}';
+  if constexpr (std::is_same_v<T, unknown_struct>) {
+    // data holds the formatted area followed by the string set.
+    auto data = std::span(s.data);
+    auto formatted = std::min<std::size_t>(s.header.length > 4 ? s.header.length - 4 : 0, data.size());
+    out += ",\"data\":";
+    put_hex(out, data.first(formatted));
+    out += ",\"strings\":[";
+    auto strings = data.subspan(formatted);
+    for (std::size_t begin = 0; begin < strings.size();) {
+      auto end = std::ranges::find(strings.subspan(begin), 0) - strings.begin();
+      out += begin ? "," : "";
+      put_string(out, {reinterpret_cast<const char*>(strings.data()) + begin, static_cast<std::size_t>(end) - begin});
+      begin = end + 1;
+    }
+    out += ']';
+  } else {
+    json_members members{out, version, false};
+    smbios_fields(s, members);
+  }
+  out += '}';
+}
+
+using structure_json = void (*)(std::string& out, const smbios& s, uint32_t version);
+
+// Checked, as any smbios subclass converts to `s`: entry points, peer
+// devices and additional_info entries have no structure class of their own.
+template<typename T>
+void put_as(std::string& out, const smbios& s, uint32_t version) {
+  auto structure = dynamic_cast<const T*>(&s);
+  if (!structure) {
+    throw std::runtime_error(std::format("not a structure of type {}", static_cast<uint8_t>(s.header.type)));
+  }
+  put_structure(out, *structure, version);
+}
+
+template<typename... Ts>
+constexpr auto make_structure_json(smbios_type_list<Ts...>) {
+  std::array<structure_json, 256> writers{};
+  writers.fill(&put_as<unknown_struct>);
+  ((writers[static_cast<uint8_t>(Ts::TYPE)] = &put_as<Ts>), ...);
+  return writers;
+}
+
+// Indexed by the structure type byte, like the decoders.
+constexpr auto structure_writers = make_structure_json(smbios_types{});
+
+smbios_json_writer::smbios_json_writer(std::string& out) : out(&out) {
+}
+
+smbios_json_writer::smbios_json_writer(int fd, std::size_t buffer_size) :
+  out(&buffer),
+  fd(fd),
+  buffer_size(buffer_size) {
+  buffer.reserve(buffer_size + buffer_size / 4);
+}
+
+smbios_json_writer::~smbios_json_writer() {
+  try {
+    flush();
+  } catch (const std::runtime_error&) {
+  }
+}
+
+void smbios_json_writer::flush_if_full() {
+  if (fd >= 0 && buffer.size() >= buffer_size) {
+    flush();
+  }
+}
+
+void smbios_json_writer::flush() {
+  if (fd < 0) {
+    return;
+  }
+  std::size_t total = 0;
+  while (total < buffer.size()) {
+#ifdef WIN32
+    auto n = ::_write(fd, buffer.data() + total, static_cast<unsigned>(buffer.size() - total));
+#else
+    auto n = ::write(fd, buffer.data() + total, buffer.size() - total);
+#endif
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      buffer.erase(0, total);
+      throw std::runtime_error(std::format("can not write to descriptor {}", fd));
+    }
+    total += static_cast<std::size_t>(n);
+  }
+  buffer.clear();
+}
+
+void smbios_json_writer::write(const smbios& structure, uint32_t version) {
+  structure_writers[static_cast<uint8_t>(structure.header.type)](*out, structure, version);
+  *out += '\n';
+  flush_if_full();
+}
+
+void smbios_json_writer::write_ndjson(const smbios_parser& parser) {
+  parser.visit([&](const auto& s) {
+    put_structure(*out, s, parser.version);
+    *out += '\n';
+    flush_if_full();
+  });
+}
+
+void smbios_json_writer::write_json(const smbios_parser& parser) {
+  *out += "{\"version\":\"";
+  put_number(*out, parser.version >> 8);
+  *out += '.';
+  put_number(*out, parser.version & 0xFF);
+  *out += "\",\"structures\":[";
+  bool first = true;
+  parser.visit([&](const auto& s) {
+    *out += first ? "\n" : ",\n";
+    first = false;
+    put_structure(*out, s, parser.version);
+    flush_if_full();
+  });
+  *out += "\n]}\n";
+  flush_if_full();
+}
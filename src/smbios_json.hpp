@@ -0,0 +1,65 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_JSON_HPP
+#define SMBIOS_SMBIOS_JSON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "smbios.hpp"
+#include "smbios_parser.hpp"
+
+// Streams structures as JSON text, field by field with no document built in
+// between. A structure is an object of its "header" ("type", "type_name",
+// "handle", "length") followed by its members under their C++ names. Enums
+// are written as enumerator names, flag enums as arrays of bit names, values
+// without a name as numbers. Byte arrays and vectors are uppercase hex
+// strings, system_info's uuid is format_uuid text. unknown_struct is written
+// as "data", its formatted area in hex, and "strings". Text that is not
+// UTF-8 is escaped byte by byte as Latin-1.
+class smbios_json_writer {
+  std::string buffer;
+  std::string* out;
+  int fd = -1;
+  std::size_t buffer_size = 0;
+
+  void flush_if_full();
+
+public:
+  // Appends to `out`, which must outlive the writer.
+  explicit smbios_json_writer(std::string& out);
+
+  // Writes to a file descriptor, handing it the text in chunks of about
+  // `buffer_size` bytes. The descriptor is not closed.
+  explicit smbios_json_writer(int fd, std::size_t buffer_size = 64 * 1024);
+
+  smbios_json_writer(const smbios_json_writer& other) = delete;
+
+  smbios_json_writer& operator=(const smbios_json_writer& other) = delete;
+
+  // Flushes, a failing descriptor is ignored here.
+  ~smbios_json_writer();
+
+  // One structure as a single-line object followed by '\n'. `version` is the
+  // table's, it orders the UUID bytes. A structure of a lazy parse must have
+  // been accessed through the parser first. Throws std::runtime_error when
+  // `structure` is not of the class its header type decodes to, e.g. an
+  // entry point or an additional_info entry.
+  void write(const smbios& structure, uint32_t version);
+
+  // Every structure of `parser` in table order, one object per line (NDJSON).
+  void write_ndjson(const smbios_parser& parser);
+
+  // `parser` as one document: {"version":"3.3","structures":[...]}.
+  void write_json(const smbios_parser& parser);
+
+  // Hands buffered text to the descriptor, throws std::runtime_error when
+  // write fails. Does nothing when writing to a string.
+  void flush();
+};
+
+
+#endif //SMBIOS_SMBIOS_JSON_HPP
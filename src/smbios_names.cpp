@@ -0,0 +1,1136 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_names.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+template<typename E>
+struct enum_name {
+  E value;
+  std::string_view name;
+};
+
+// Tables are sorted by value, first enumerator wins where two share one.
+template<typename E, std::size_t N>
+static std::string_view find_name(const enum_name<E> (&names)[N], E value) {
+  auto it = std::ranges::lower_bound(names, value, std::less<>(), &enum_name<E>::value);
+  return it != std::end(names) && it->value == value ? it->name : std::string_view();
+}
+
+constexpr enum_name<smbios_type> smbios_type_names[] = {
+  {smbios_type::bios_information, "bios_information"},
+  {smbios_type::system_information, "system_information"},
+  {smbios_type::baseboard_information, "baseboard_information"},
+  {smbios_type::system_enclosure, "system_enclosure"},
+  {smbios_type::processor_information, "processor_information"},
+  {smbios_type::memory_controller, "memory_controller"},
+  {smbios_type::memory_module, "memory_module"},
+  {smbios_type::cache_information, "cache_information"},
+  {smbios_type::port_connector_information, "port_connector_information"},
+  {smbios_type::system_slots, "system_slots"},
+  {smbios_type::onboard_devices_information, "onboard_devices_information"},
+  {smbios_type::oem_strings, "oem_strings"},
+  {smbios_type::system_configuration_options, "system_configuration_options"},
+  {smbios_type::bios_language, "bios_language"},
+  {smbios_type::group_associations, "group_associations"},
+  {smbios_type::system_event_log, "system_event_log"},
+  {smbios_type::physical_memory_array, "physical_memory_array"},
+  {smbios_type::memory_device, "memory_device"},
+  {smbios_type::memory_error_information_32, "memory_error_information_32"},
+  {smbios_type::memory_array_mapped_address, "memory_array_mapped_address"},
+  {smbios_type::memory_device_mapped_address, "memory_device_mapped_address"},
+  {smbios_type::built_in_pointing_device, "built_in_pointing_device"},
+  {smbios_type::portable_battery, "portable_battery"},
+  {smbios_type::system_reset, "system_reset"},
+  {smbios_type::hardware_security, "hardware_security"},
+  {smbios_type::system_power_controls, "system_power_controls"},
+  {smbios_type::voltage_probe, "voltage_probe"},
+  {smbios_type::cooling_device, "cooling_device"},
+  {smbios_type::temperature_probe, "temperature_probe"},
+  {smbios_type::electrical_current_probe, "electrical_current_probe"},
+  {smbios_type::out_of_band_remote_access, "out_of_band_remote_access"},
+  {smbios_type::boot_integrity_services, "boot_integrity_services"},
+  {smbios_type::system_boot_information, "system_boot_information"},
+  {smbios_type::memory_error_information_64, "memory_error_information_64"},
+  {smbios_type::management_device, "management_device"},
+  {smbios_type::management_device_component, "management_device_component"},
+  {smbios_type::management_device_threshold_data, "management_device_threshold_data"},
+  {smbios_type::memory_channel, "memory_channel"},
+  {smbios_type::ipmi_device_information, "ipmi_device_information"},
+  {smbios_type::power_supply, "power_supply"},
+  {smbios_type::additional_information, "additional_information"},
+  {smbios_type::onboard_devices_extended_info, "onboard_devices_extended_info"},
+  {smbios_type::management_controller_host_interface, "management_controller_host_interface"},
+  {smbios_type::tpm_device, "tpm_device"},
+  {smbios_type::processor_additional_information, "processor_additional_information"},
+  {smbios_type::firmware_inventory_information, "firmware_inventory_information"},
+  {smbios_type::string_property, "string_property"},
+  {smbios_type::inactive, "inactive"},
+  {smbios_type::end_of_table, "end_of_table"},
+};
+
+std::string_view smbios_name(smbios_type value) {
+  return find_name(smbios_type_names, value);
+}
+
+constexpr enum_name<bios_characteristics> bios_characteristics_names[] = {
+  {bios_characteristics::reserved_0, "reserved_0"},
+  {bios_characteristics::reserved_1, "reserved_1"},
+  {bios_characteristics::unknown, "unknown"},
+  {bios_characteristics::not_supported, "not_supported"},
+  {bios_characteristics::isa_supported, "isa_supported"},
+  {bios_characteristics::mca_supported, "mca_supported"},
+  {bios_characteristics::eisa_supported, "eisa_supported"},
+  {bios_characteristics::pci_supported, "pci_supported"},
+  {bios_characteristics::pc_card_supported, "pc_card_supported"},
+  {bios_characteristics::plug_and_play_supported, "plug_and_play_supported"},
+  {bios_characteristics::apm_supported, "apm_supported"},
+  {bios_characteristics::bios_upgradeable, "bios_upgradeable"},
+  {bios_characteristics::bios_shadowing_allowed, "bios_shadowing_allowed"},
+  {bios_characteristics::vl_vesa_supported, "vl_vesa_supported"},
+  {bios_characteristics::escd_supported, "escd_supported"},
+  {bios_characteristics::boot_from_cd_supported, "boot_from_cd_supported"},
+  {bios_characteristics::selectable_boot_supported, "selectable_boot_supported"},
+  {bios_characteristics::bios_rom_socketed, "bios_rom_socketed"},
+  {bios_characteristics::boot_from_pc_card_supported, "boot_from_pc_card_supported"},
+  {bios_characteristics::edd_specification_supported, "edd_specification_supported"},
+  {bios_characteristics::japanese_floppy_nec_9800_supported, "japanese_floppy_nec_9800_supported"},
+  {bios_characteristics::japanese_floppy_toshiba_supported, "japanese_floppy_toshiba_supported"},
+  {bios_characteristics::floppy_5_25_360kb_supported, "floppy_5_25_360kb_supported"},
+  {bios_characteristics::floppy_5_25_1_2mb_supported, "floppy_5_25_1_2mb_supported"},
+  {bios_characteristics::floppy_3_5_720kb_supported, "floppy_3_5_720kb_supported"},
+  {bios_characteristics::floppy_3_5_2_88mb_supported, "floppy_3_5_2_88mb_supported"},
+  {bios_characteristics::print_screen_service_supported, "print_screen_service_supported"},
+  {bios_characteristics::keyboard_service_supported, "keyboard_service_supported"},
+  {bios_characteristics::serial_service_supported, "serial_service_supported"},
+  {bios_characteristics::printer_service_supported, "printer_service_supported"},
+  {bios_characteristics::video_service_supported, "video_service_supported"},
+  {bios_characteristics::nec_pc_98, "nec_pc_98"},
+};
+
+std::string_view smbios_name(bios_characteristics value) {
+  return find_name(bios_characteristics_names, value);
+}
+
+constexpr enum_name<bios_char_ext_byte1> bios_char_ext_byte1_names[] = {
+  {bios_char_ext_byte1::acpi_supported, "acpi_supported"},
+  {bios_char_ext_byte1::usb_legacy_supported, "usb_legacy_supported"},
+  {bios_char_ext_byte1::agp_supported, "agp_supported"},
+  {bios_char_ext_byte1::i2o_boot_supported, "i2o_boot_supported"},
+  {bios_char_ext_byte1::ls_120_boot_supported, "ls_120_boot_supported"},
+  {bios_char_ext_byte1::atapi_zip_boot_supported, "atapi_zip_boot_supported"},
+  {bios_char_ext_byte1::ieee_1394_boot_supported, "ieee_1394_boot_supported"},
+  {bios_char_ext_byte1::smart_battery_supported, "smart_battery_supported"},
+};
+
+std::string_view smbios_name(bios_char_ext_byte1 value) {
+  return find_name(bios_char_ext_byte1_names, value);
+}
+
+constexpr enum_name<bios_char_ext_byte2> bios_char_ext_byte2_names[] = {
+  {bios_char_ext_byte2::bios_boot_specification_supported, "bios_boot_specification_supported"},
+  {bios_char_ext_byte2::function_key_network_service_boot_supported, "function_key_network_service_boot_supported"},
+  {bios_char_ext_byte2::targeted_content_distribution_enabled, "targeted_content_distribution_enabled"},
+  {bios_char_ext_byte2::uefi_specification_supported, "uefi_specification_supported"},
+  {bios_char_ext_byte2::smbios_describes_virtual_machine, "smbios_describes_virtual_machine"},
+};
+
+std::string_view smbios_name(bios_char_ext_byte2 value) {
+  return find_name(bios_char_ext_byte2_names, value);
+}
+
+constexpr enum_name<wake_up_type> wake_up_type_names[] = {
+  {wake_up_type::reserved, "reserved"},
+  {wake_up_type::other, "other"},
+  {wake_up_type::unknown, "unknown"},
+  {wake_up_type::apm_timer, "apm_timer"},
+  {wake_up_type::modem_ring, "modem_ring"},
+  {wake_up_type::lan_remote, "lan_remote"},
+  {wake_up_type::power_switch, "power_switch"},
+  {wake_up_type::pci_pme, "pci_pme"},
+  {wake_up_type::ac_power_restored, "ac_power_restored"},
+};
+
+std::string_view smbios_name(wake_up_type value) {
+  return find_name(wake_up_type_names, value);
+}
+
+constexpr enum_name<feature_flag> feature_flag_names[] = {
+  {feature_flag::hosting_board, "hosting_board"},
+  {feature_flag::requires_auxiliary_cards, "requires_auxiliary_cards"},
+  {feature_flag::removable_board, "removable_board"},
+  {feature_flag::replaceable_board, "replaceable_board"},
+  {feature_flag::hot_swappable_board, "hot_swappable_board"},
+};
+
+std::string_view smbios_name(feature_flag value) {
+  return find_name(feature_flag_names, value);
+}
+
+constexpr enum_name<board_type> board_type_names[] = {
+  {board_type::unknown, "unknown"},
+  {board_type::other, "other"},
+  {board_type::server_blade, "server_blade"},
+  {board_type::connectivity_switch, "connectivity_switch"},
+  {board_type::system_management_module, "system_management_module"},
+  {board_type::processor_module, "processor_module"},
+  {board_type::io_module, "io_module"},
+  {board_type::memory_module, "memory_module"},
+  {board_type::daughter_board, "daughter_board"},
+  {board_type::motherboard, "motherboard"},
+  {board_type::processor_memory_module, "processor_memory_module"},
+  {board_type::processor_io_module, "processor_io_module"},
+  {board_type::interconnect_board, "interconnect_board"},
+};
+
+std::string_view smbios_name(board_type value) {
+  return find_name(board_type_names, value);
+}
+
+constexpr enum_name<chassis_type> chassis_type_names[] = {
+  {chassis_type::other, "other"},
+  {chassis_type::unknown, "unknown"},
+  {chassis_type::desktop, "desktop"},
+  {chassis_type::low_profile_desktop, "low_profile_desktop"},
+  {chassis_type::pizza_box, "pizza_box"},
+  {chassis_type::mini_tower, "mini_tower"},
+  {chassis_type::tower, "tower"},
+  {chassis_type::portable, "portable"},
+  {chassis_type::laptop, "laptop"},
+  {chassis_type::notebook, "notebook"},
+  {chassis_type::hand_held, "hand_held"},
+  {chassis_type::docking_station, "docking_station"},
+  {chassis_type::all_in_one, "all_in_one"},
+  {chassis_type::sub_notebook, "sub_notebook"},
+  {chassis_type::space_saving, "space_saving"},
+  {chassis_type::lunch_box, "lunch_box"},
+  {chassis_type::main_server_chassis, "main_server_chassis"},
+  {chassis_type::expansion_chassis, "expansion_chassis"},
+  {chassis_type::sub_chassis, "sub_chassis"},
+  {chassis_type::bus_expansion_chassis, "bus_expansion_chassis"},
+  {chassis_type::peripheral_chassis, "peripheral_chassis"},
+  {chassis_type::raid_chassis, "raid_chassis"},
+  {chassis_type::rack_mount_chassis, "rack_mount_chassis"},
+  {chassis_type::sealed_case_pc, "sealed_case_pc"},
+  {chassis_type::multi_system_chassis, "multi_system_chassis"},
+  {chassis_type::compact_pci, "compact_pci"},
+  {chassis_type::advanced_tca, "advanced_tca"},
+  {chassis_type::blade, "blade"},
+  {chassis_type::blade_enclosure, "blade_enclosure"},
+  {chassis_type::tablet, "tablet"},
+  {chassis_type::convertible, "convertible"},
+  {chassis_type::detachable, "detachable"},
+  {chassis_type::iot_gateway, "iot_gateway"},
+  {chassis_type::embedded_pc, "embedded_pc"},
+  {chassis_type::mini_pc, "mini_pc"},
+  {chassis_type::stick_pc, "stick_pc"},
+  {chassis_type::chassis_lock_present, "chassis_lock_present"},
+};
+
+std::string_view smbios_name(chassis_type value) {
+  return find_name(chassis_type_names, value);
+}
+
+constexpr enum_name<system_enclosure_state> system_enclosure_state_names[] = {
+  {system_enclosure_state::other, "other"},
+  {system_enclosure_state::unknown, "unknown"},
+  {system_enclosure_state::safe, "safe"},
+  {system_enclosure_state::warning, "warning"},
+  {system_enclosure_state::critical, "critical"},
+  {system_enclosure_state::non_recoverable, "non_recoverable"},
+};
+
+std::string_view smbios_name(system_enclosure_state value) {
+  return find_name(system_enclosure_state_names, value);
+}
+
+constexpr enum_name<security_status> security_status_names[] = {
+  {security_status::other, "other"},
+  {security_status::unknown, "unknown"},
+  {security_status::none, "none"},
+  {security_status::external_interface_locked_out, "external_interface_locked_out"},
+  {security_status::external_interface_enabled, "external_interface_enabled"},
+};
+
+std::string_view smbios_name(security_status value) {
+  return find_name(security_status_names, value);
+}
+
+constexpr enum_name<processor_upgrade> processor_upgrade_names[] = {
+  {processor_upgrade::other, "other"},
+  {processor_upgrade::unknown, "unknown"},
+  {processor_upgrade::daughter_board, "daughter_board"},
+  {processor_upgrade::zif_socket, "zif_socket"},
+  {processor_upgrade::replaceable_piggy_back, "replaceable_piggy_back"},
+  {processor_upgrade::none, "none"},
+  {processor_upgrade::lif_socket, "lif_socket"},
+  {processor_upgrade::slot_1, "slot_1"},
+  {processor_upgrade::slot_2, "slot_2"},
+  {processor_upgrade::socket_370_pin, "socket_370_pin"},
+  {processor_upgrade::slot_a, "slot_a"},
+  {processor_upgrade::slot_m, "slot_m"},
+  {processor_upgrade::socket_423, "socket_423"},
+  {processor_upgrade::socket_a_462, "socket_a_462"},
+  {processor_upgrade::socket_478, "socket_478"},
+  {processor_upgrade::socket_754, "socket_754"},
+  {processor_upgrade::socket_940, "socket_940"},
+  {processor_upgrade::socket_939, "socket_939"},
+  {processor_upgrade::socket_mpga604, "socket_mpga604"},
+  {processor_upgrade::socket_lga771, "socket_lga771"},
+  {processor_upgrade::socket_lga775, "socket_lga775"},
+  {processor_upgrade::socket_s1, "socket_s1"},
+  {processor_upgrade::socket_am2, "socket_am2"},
+  {processor_upgrade::socket_f_1207, "socket_f_1207"},
+  {processor_upgrade::socket_lga1366, "socket_lga1366"},
+  {processor_upgrade::socket_g34, "socket_g34"},
+  {processor_upgrade::socket_am3, "socket_am3"},
+  {processor_upgrade::socket_c32, "socket_c32"},
+  {processor_upgrade::socket_lga1156, "socket_lga1156"},
+  {processor_upgrade::socket_lga1567, "socket_lga1567"},
+  {processor_upgrade::socket_pga988a, "socket_pga988a"},
+  {processor_upgrade::socket_bga1288, "socket_bga1288"},
+  {processor_upgrade::socket_rpga988b, "socket_rpga988b"},
+  {processor_upgrade::socket_bga1023, "socket_bga1023"},
+  {processor_upgrade::socket_bga1224, "socket_bga1224"},
+  {processor_upgrade::socket_lga1155, "socket_lga1155"},
+  {processor_upgrade::socket_lga1356, "socket_lga1356"},
+  {processor_upgrade::socket_lga2011, "socket_lga2011"},
+  {processor_upgrade::socket_fs1, "socket_fs1"},
+  {processor_upgrade::socket_fs2, "socket_fs2"},
+  {processor_upgrade::socket_fm1, "socket_fm1"},
+  {processor_upgrade::socket_fm2, "socket_fm2"},
+  {processor_upgrade::socket_lga2011_3, "socket_lga2011_3"},
+  {processor_upgrade::socket_lga1356_3, "socket_lga1356_3"},
+  {processor_upgrade::socket_lga1150, "socket_lga1150"},
+  {processor_upgrade::socket_bga1168, "socket_bga1168"},
+  {processor_upgrade::socket_bga1234, "socket_bga1234"},
+  {processor_upgrade::socket_bga1364, "socket_bga1364"},
+  {processor_upgrade::socket_am4, "socket_am4"},
+  {processor_upgrade::socket_lga1151, "socket_lga1151"},
+  {processor_upgrade::socket_bga1356, "socket_bga1356"},
+  {processor_upgrade::socket_bga1440, "socket_bga1440"},
+  {processor_upgrade::socket_bga1515, "socket_bga1515"},
+  {processor_upgrade::socket_lga3647_1, "socket_lga3647_1"},
+  {processor_upgrade::socket_sp3, "socket_sp3"},
+  {processor_upgrade::socket_sp3r2, "socket_sp3r2"},
+  {processor_upgrade::socket_lga2066, "socket_lga2066"},
+  {processor_upgrade::socket_bga1392, "socket_bga1392"},
+  {processor_upgrade::socket_bga1510, "socket_bga1510"},
+  {processor_upgrade::socket_bga1528, "socket_bga1528"},
+  {processor_upgrade::socket_lga4189, "socket_lga4189"},
+  {processor_upgrade::socket_lga1200, "socket_lga1200"},
+};
+
+std::string_view smbios_name(processor_upgrade value) {
+  return find_name(processor_upgrade_names, value);
+}
+
+constexpr enum_name<processor_type> processor_type_names[] = {
+  {processor_type::other, "other"},
+  {processor_type::unknown, "unknown"},
+  {processor_type::central_processor, "central_processor"},
+  {processor_type::math_processor, "math_processor"},
+  {processor_type::dsp_processor, "dsp_processor"},
+  {processor_type::video_processor, "video_processor"},
+};
+
+std::string_view smbios_name(processor_type value) {
+  return find_name(processor_type_names, value);
+}
+
+constexpr enum_name<processor_family> processor_family_names[] = {
+  {processor_family::other, "other"},
+  {processor_family::unknown, "unknown"},
+  {processor_family::intel_8086, "intel_8086"},
+  {processor_family::intel_80286, "intel_80286"},
+  {processor_family::intel_386, "intel_386"},
+  {processor_family::intel_486, "intel_486"},
+  {processor_family::intel_8087, "intel_8087"},
+  {processor_family::intel_80287, "intel_80287"},
+  {processor_family::intel_80387, "intel_80387"},
+  {processor_family::intel_80487, "intel_80487"},
+  {processor_family::intel_pentium, "intel_pentium"},
+  {processor_family::intel_pentium_pro, "intel_pentium_pro"},
+  {processor_family::intel_pentium_ii, "intel_pentium_ii"},
+  {processor_family::intel_pentium_mmx, "intel_pentium_mmx"},
+  {processor_family::intel_celeron, "intel_celeron"},
+  {processor_family::intel_pentium_ii_xeon, "intel_pentium_ii_xeon"},
+  {processor_family::intel_pentium_iii, "intel_pentium_iii"},
+  {processor_family::m1_family, "m1_family"},
+  {processor_family::m2_family, "m2_family"},
+  {processor_family::intel_celeron_m, "intel_celeron_m"},
+  {processor_family::intel_pentium_4_ht, "intel_pentium_4_ht"},
+  {processor_family::amd_duron, "amd_duron"},
+  {processor_family::amd_k5, "amd_k5"},
+  {processor_family::amd_k6, "amd_k6"},
+  {processor_family::amd_k6_2, "amd_k6_2"},
+  {processor_family::amd_k6_3, "amd_k6_3"},
+  {processor_family::amd_athlon, "amd_athlon"},
+  {processor_family::amd_29000, "amd_29000"},
+  {processor_family::amd_k6_2_plus, "amd_k6_2_plus"},
+  {processor_family::powerpc_family, "powerpc_family"},
+  {processor_family::powerpc_601, "powerpc_601"},
+  {processor_family::powerpc_603, "powerpc_603"},
+  {processor_family::powerpc_603_plus, "powerpc_603_plus"},
+  {processor_family::powerpc_604, "powerpc_604"},
+  {processor_family::powerpc_620, "powerpc_620"},
+  {processor_family::powerpc_x704, "powerpc_x704"},
+  {processor_family::powerpc_750, "powerpc_750"},
+  {processor_family::intel_core_duo, "intel_core_duo"},
+  {processor_family::intel_core_duo_mobile, "intel_core_duo_mobile"},
+  {processor_family::intel_core_solo_mobile, "intel_core_solo_mobile"},
+  {processor_family::intel_atom, "intel_atom"},
+  {processor_family::intel_core_m, "intel_core_m"},
+  {processor_family::intel_core_m3, "intel_core_m3"},
+  {processor_family::intel_core_m5, "intel_core_m5"},
+  {processor_family::intel_core_m7, "intel_core_m7"},
+  {processor_family::alpha_family, "alpha_family"},
+  {processor_family::alpha_21064, "alpha_21064"},
+  {processor_family::alpha_21066, "alpha_21066"},
+  {processor_family::alpha_21164, "alpha_21164"},
+  {processor_family::alpha_21164pc, "alpha_21164pc"},
+  {processor_family::alpha_21164a, "alpha_21164a"},
+  {processor_family::alpha_21264, "alpha_21264"},
+  {processor_family::alpha_21364, "alpha_21364"},
+  {processor_family::amd_turion_ii_ultra_dual_core_mobile_m, "amd_turion_ii_ultra_dual_core_mobile_m"},
+  {processor_family::amd_turion_ii_dual_core_mobile_m, "amd_turion_ii_dual_core_mobile_m"},
+  {processor_family::amd_athlon_ii_dual_core_mobile_m, "amd_athlon_ii_dual_core_mobile_m"},
+  {processor_family::amd_opteron_6100, "amd_opteron_6100"},
+  {processor_family::amd_opteron_4100, "amd_opteron_4100"},
+  {processor_family::amd_opteron_6200, "amd_opteron_6200"},
+  {processor_family::amd_opteron_4200, "amd_opteron_4200"},
+  {processor_family::amd_fx_series, "amd_fx_series"},
+  {processor_family::mips_family, "mips_family"},
+  {processor_family::mips_r4000, "mips_r4000"},
+  {processor_family::mips_r4200, "mips_r4200"},
+  {processor_family::mips_r4400, "mips_r4400"},
+  {processor_family::mips_r4600, "mips_r4600"},
+  {processor_family::mips_r10000, "mips_r10000"},
+  {processor_family::amd_c_series, "amd_c_series"},
+  {processor_family::amd_e_series, "amd_e_series"},
+  {processor_family::amd_a_series, "amd_a_series"},
+  {processor_family::amd_g_series, "amd_g_series"},
+  {processor_family::amd_z_series, "amd_z_series"},
+  {processor_family::amd_r_series, "amd_r_series"},
+  {processor_family::amd_opteron_4300, "amd_opteron_4300"},
+  {processor_family::amd_opteron_6300, "amd_opteron_6300"},
+  {processor_family::amd_opteron_3300, "amd_opteron_3300"},
+  {processor_family::amd_firepro, "amd_firepro"},
+  {processor_family::sparc_family, "sparc_family"},
+  {processor_family::supersparc, "supersparc"},
+  {processor_family::microsparc_ii, "microsparc_ii"},
+  {processor_family::microsparc_iiep, "microsparc_iiep"},
+  {processor_family::ultrasparc, "ultrasparc"},
+  {processor_family::ultrasparc_ii, "ultrasparc_ii"},
+  {processor_family::ultrasparc_iii, "ultrasparc_iii"},
+  {processor_family::ultrasparc_iii_plus, "ultrasparc_iii_plus"},
+  {processor_family::ultrasparc_iii_i, "ultrasparc_iii_i"},
+  {processor_family::family_68040, "family_68040"},
+  {processor_family::family_68xxx, "family_68xxx"},
+  {processor_family::family_68000, "family_68000"},
+  {processor_family::family_68010, "family_68010"},
+  {processor_family::family_68020, "family_68020"},
+  {processor_family::family_68030, "family_68030"},
+  {processor_family::amd_athlon_x4_quad_core, "amd_athlon_x4_quad_core"},
+  {processor_family::amd_opteron_x1000, "amd_opteron_x1000"},
+  {processor_family::amd_opteron_x2000_apu, "amd_opteron_x2000_apu"},
+  {processor_family::amd_opteron_a_series, "amd_opteron_a_series"},
+  {processor_family::amd_opteron_x3000_apu, "amd_opteron_x3000_apu"},
+  {processor_family::amd_zen, "amd_zen"},
+  {processor_family::hobbit_family, "hobbit_family"},
+  {processor_family::crusoe_tm5000, "crusoe_tm5000"},
+  {processor_family::crusoe_tm3000, "crusoe_tm3000"},
+  {processor_family::efficeon_tm8000, "efficeon_tm8000"},
+  {processor_family::weitek, "weitek"},
+  {processor_family::itanium, "itanium"},
+  {processor_family::amd_athlon_64, "amd_athlon_64"},
+  {processor_family::amd_opteron, "amd_opteron"},
+  {processor_family::amd_sempron, "amd_sempron"},
+  {processor_family::amd_turion_64_mobile, "amd_turion_64_mobile"},
+  {processor_family::amd_opteron_dual_core, "amd_opteron_dual_core"},
+  {processor_family::amd_athlon_64_x2_dual_core, "amd_athlon_64_x2_dual_core"},
+  {processor_family::amd_turion_64_x2_mobile, "amd_turion_64_x2_mobile"},
+  {processor_family::amd_opteron_quad_core, "amd_opteron_quad_core"},
+  {processor_family::amd_opteron_third_generation, "amd_opteron_third_generation"},
+  {processor_family::amd_phenom_fx_quad_core, "amd_phenom_fx_quad_core"},
+  {processor_family::amd_phenom_x4_quad_core, "amd_phenom_x4_quad_core"},
+  {processor_family::amd_phenom_x2_dual_core, "amd_phenom_x2_dual_core"},
+  {processor_family::amd_athlon_x2_dual_core, "amd_athlon_x2_dual_core"},
+  {processor_family::pa_risc_family, "pa_risc_family"},
+  {processor_family::pa_risc_8500, "pa_risc_8500"},
+  {processor_family::pa_risc_8000, "pa_risc_8000"},
+  {processor_family::pa_risc_7300lc, "pa_risc_7300lc"},
+  {processor_family::pa_risc_7200, "pa_risc_7200"},
+  {processor_family::pa_risc_7100lc, "pa_risc_7100lc"},
+  {processor_family::pa_risc_7100, "pa_risc_7100"},
+  {processor_family::v30_family, "v30_family"},
+};
+
+std::string_view smbios_name(processor_family value) {
+  return find_name(processor_family_names, value);
+}
+
+constexpr enum_name<processor_characteristics> processor_characteristics_names[] = {
+  {processor_characteristics::unknown, "unknown"},
+  {processor_characteristics::bit64_capable, "bit64_capable"},
+  {processor_characteristics::multicore, "multicore"},
+  {processor_characteristics::hardware_thread, "hardware_thread"},
+  {processor_characteristics::execute_protection, "execute_protection"},
+  {processor_characteristics::enhanced_virtualization, "enhanced_virtualization"},
+  {processor_characteristics::power_performance_control, "power_performance_control"},
+  {processor_characteristics::bit32_capable, "bit32_capable"},
+  {processor_characteristics::arm64_soc_id, "arm64_soc_id"},
+};
+
+std::string_view smbios_name(processor_characteristics value) {
+  return find_name(processor_characteristics_names, value);
+}
+
+constexpr enum_name<cpu_status_enum> cpu_status_enum_names[] = {
+  {cpu_status_enum::unknown, "unknown"},
+  {cpu_status_enum::cpu_enabled, "cpu_enabled"},
+  {cpu_status_enum::cpu_disabled_by_user, "cpu_disabled_by_user"},
+  {cpu_status_enum::cpu_disabled_by_bios, "cpu_disabled_by_bios"},
+  {cpu_status_enum::idle, "idle"},
+  {cpu_status_enum::reserved, "reserved"},
+  {cpu_status_enum::reserved2, "reserved2"},
+  {cpu_status_enum::other, "other"},
+};
+
+std::string_view smbios_name(cpu_status_enum value) {
+  return find_name(cpu_status_enum_names, value);
+}
+
+constexpr enum_name<cpu_socket> cpu_socket_names[] = {
+  {cpu_socket::socket_unpopulated, "socket_unpopulated"},
+  {cpu_socket::socket_populated, "socket_populated"},
+};
+
+std::string_view smbios_name(cpu_socket value) {
+  return find_name(cpu_socket_names, value);
+}
+
+constexpr enum_name<cache_level> cache_level_names[] = {
+  {cache_level::l1, "l1"},
+  {cache_level::l2, "l2"},
+  {cache_level::l3, "l3"},
+  {cache_level::l4, "l4"},
+  {cache_level::l5, "l5"},
+  {cache_level::l6, "l6"},
+  {cache_level::l7, "l7"},
+  {cache_level::l8, "l8"},
+};
+
+std::string_view smbios_name(cache_level value) {
+  return find_name(cache_level_names, value);
+}
+
+constexpr enum_name<cache_socket> cache_socket_names[] = {
+  {cache_socket::not_socketed, "not_socketed"},
+  {cache_socket::socketed, "socketed"},
+};
+
+std::string_view smbios_name(cache_socket value) {
+  return find_name(cache_socket_names, value);
+}
+
+constexpr enum_name<cache_location> cache_location_names[] = {
+  {cache_location::internal, "internal"},
+  {cache_location::external, "external"},
+  {cache_location::reserved, "reserved"},
+  {cache_location::unknown, "unknown"},
+};
+
+std::string_view smbios_name(cache_location value) {
+  return find_name(cache_location_names, value);
+}
+
+constexpr enum_name<cache_state> cache_state_names[] = {
+  {cache_state::disabled, "disabled"},
+  {cache_state::enabled, "enabled"},
+};
+
+std::string_view smbios_name(cache_state value) {
+  return find_name(cache_state_names, value);
+}
+
+constexpr enum_name<cache_operational_mode> cache_operational_mode_names[] = {
+  {cache_operational_mode::write_through, "write_through"},
+  {cache_operational_mode::write_back, "write_back"},
+  {cache_operational_mode::varies_with_address, "varies_with_address"},
+  {cache_operational_mode::unknown, "unknown"},
+};
+
+std::string_view smbios_name(cache_operational_mode value) {
+  return find_name(cache_operational_mode_names, value);
+}
+
+constexpr enum_name<cache_granularity> cache_granularity_names[] = {
+  {cache_granularity::granularity_1k, "granularity_1k"},
+  {cache_granularity::granularity_64k, "granularity_64k"},
+};
+
+std::string_view smbios_name(cache_granularity value) {
+  return find_name(cache_granularity_names, value);
+}
+
+constexpr enum_name<sram_type> sram_type_names[] = {
+  {sram_type::other, "other"},
+  {sram_type::unknown, "unknown"},
+  {sram_type::non_burst, "non_burst"},
+  {sram_type::burst, "burst"},
+  {sram_type::pipeline_burst, "pipeline_burst"},
+  {sram_type::synchronous, "synchronous"},
+  {sram_type::asynchronous, "asynchronous"},
+};
+
+std::string_view smbios_name(sram_type value) {
+  return find_name(sram_type_names, value);
+}
+
+constexpr enum_name<error_correction_type> error_correction_type_names[] = {
+  {error_correction_type::other, "other"},
+  {error_correction_type::unknown, "unknown"},
+  {error_correction_type::none, "none"},
+  {error_correction_type::parity, "parity"},
+  {error_correction_type::single_bit_ecc, "single_bit_ecc"},
+  {error_correction_type::multi_bit_ecc, "multi_bit_ecc"},
+};
+
+std::string_view smbios_name(error_correction_type value) {
+  return find_name(error_correction_type_names, value);
+}
+
+constexpr enum_name<system_cache_type> system_cache_type_names[] = {
+  {system_cache_type::other, "other"},
+  {system_cache_type::unknown, "unknown"},
+  {system_cache_type::instruction, "instruction"},
+  {system_cache_type::data, "data"},
+  {system_cache_type::unified, "unified"},
+};
+
+std::string_view smbios_name(system_cache_type value) {
+  return find_name(system_cache_type_names, value);
+}
+
+constexpr enum_name<associativity> associativity_names[] = {
+  {associativity::other, "other"},
+  {associativity::unknown, "unknown"},
+  {associativity::direct_mapped, "direct_mapped"},
+  {associativity::set_associative_2_way, "set_associative_2_way"},
+  {associativity::set_associative_4_way, "set_associative_4_way"},
+  {associativity::fully_associative, "fully_associative"},
+  {associativity::set_associative_8_way, "set_associative_8_way"},
+  {associativity::set_associative_16_way, "set_associative_16_way"},
+  {associativity::set_associative_12_way, "set_associative_12_way"},
+  {associativity::set_associative_24_way, "set_associative_24_way"},
+  {associativity::set_associative_32_way, "set_associative_32_way"},
+  {associativity::set_associative_48_way, "set_associative_48_way"},
+  {associativity::set_associative_64_way, "set_associative_64_way"},
+  {associativity::set_associative_20_way, "set_associative_20_way"},
+};
+
+std::string_view smbios_name(associativity value) {
+  return find_name(associativity_names, value);
+}
+
+constexpr enum_name<connector_type> connector_type_names[] = {
+  {connector_type::none, "none"},
+  {connector_type::centronics, "centronics"},
+  {connector_type::mini_centronics, "mini_centronics"},
+  {connector_type::proprietary, "proprietary"},
+  {connector_type::db25_pin_male, "db25_pin_male"},
+  {connector_type::db25_pin_female, "db25_pin_female"},
+  {connector_type::db15_pin_male, "db15_pin_male"},
+  {connector_type::db15_pin_female, "db15_pin_female"},
+  {connector_type::db9_pin_male, "db9_pin_male"},
+  {connector_type::db9_pin_female, "db9_pin_female"},
+  {connector_type::rj11, "rj11"},
+  {connector_type::rj45, "rj45"},
+  {connector_type::pin50_mini_scsi, "pin50_mini_scsi"},
+  {connector_type::mini_din, "mini_din"},
+  {connector_type::micro_din, "micro_din"},
+  {connector_type::ps2, "ps2"},
+  {connector_type::infrared, "infrared"},
+  {connector_type::hp_hil, "hp_hil"},
+  {connector_type::access_bus_usb, "access_bus_usb"},
+  {connector_type::ssa_scsi, "ssa_scsi"},
+  {connector_type::circular_din_8_male, "circular_din_8_male"},
+  {connector_type::circular_din_8_female, "circular_din_8_female"},
+  {connector_type::onboard_ide, "onboard_ide"},
+  {connector_type::onboard_floppy, "onboard_floppy"},
+  {connector_type::pin9_dual_inline_pin10_cut, "pin9_dual_inline_pin10_cut"},
+  {connector_type::pin25_dual_inline_pin26_cut, "pin25_dual_inline_pin26_cut"},
+  {connector_type::pin50_dual_inline, "pin50_dual_inline"},
+  {connector_type::pin68_dual_inline, "pin68_dual_inline"},
+  {connector_type::onboard_sound_input_from_cdrom, "onboard_sound_input_from_cdrom"},
+  {connector_type::mini_centronics_type14, "mini_centronics_type14"},
+  {connector_type::mini_centronics_type26, "mini_centronics_type26"},
+  {connector_type::mini_jack_headphones, "mini_jack_headphones"},
+  {connector_type::bnc, "bnc"},
+  {connector_type::ieee1394, "ieee1394"},
+  {connector_type::sas_sata_plug_receptacle, "sas_sata_plug_receptacle"},
+  {connector_type::usb_type_c_receptacle, "usb_type_c_receptacle"},
+  {connector_type::pc98, "pc98"},
+  {connector_type::pc98_hireso, "pc98_hireso"},
+  {connector_type::pc_h98, "pc_h98"},
+  {connector_type::pc98_note, "pc98_note"},
+  {connector_type::pc98_full, "pc98_full"},
+  {connector_type::other, "other"},
+};
+
+std::string_view smbios_name(connector_type value) {
+  return find_name(connector_type_names, value);
+}
+
+constexpr enum_name<port_type> port_type_names[] = {
+  {port_type::none, "none"},
+  {port_type::parallel_port_xt_at_compatible, "parallel_port_xt_at_compatible"},
+  {port_type::parallel_port_ps2, "parallel_port_ps2"},
+  {port_type::parallel_port_ecp, "parallel_port_ecp"},
+  {port_type::parallel_port_epp, "parallel_port_epp"},
+  {port_type::parallel_port_ecp_epp, "parallel_port_ecp_epp"},
+  {port_type::serial_port_xt_at_compatible, "serial_port_xt_at_compatible"},
+  {port_type::serial_port_16450_compatible, "serial_port_16450_compatible"},
+  {port_type::serial_port_16550_compatible, "serial_port_16550_compatible"},
+  {port_type::serial_port_16550a_compatible, "serial_port_16550a_compatible"},
+  {port_type::scsi_port, "scsi_port"},
+  {port_type::midi_port, "midi_port"},
+  {port_type::joy_stick_port, "joy_stick_port"},
+  {port_type::keyboard_port, "keyboard_port"},
+  {port_type::mouse_port, "mouse_port"},
+  {port_type::ssa_scsi, "ssa_scsi"},
+  {port_type::usb, "usb"},
+  {port_type::firewire_ieee_1394, "firewire_ieee_1394"},
+  {port_type::pcmcia_type_i2, "pcmcia_type_i2"},
+  {port_type::pcmcia_type_ii, "pcmcia_type_ii"},
+  {port_type::pcmcia_type_iii, "pcmcia_type_iii"},
+  {port_type::cardbus, "cardbus"},
+  {port_type::access_bus_port, "access_bus_port"},
+  {port_type::scsi_ii, "scsi_ii"},
+  {port_type::scsi_wide, "scsi_wide"},
+  {port_type::pc_98, "pc_98"},
+  {port_type::pc_98_hireso, "pc_98_hireso"},
+  {port_type::pc_h98, "pc_h98"},
+  {port_type::video_port, "video_port"},
+  {port_type::audio_port, "audio_port"},
+  {port_type::modem_port, "modem_port"},
+  {port_type::network_port, "network_port"},
+  {port_type::sata, "sata"},
+  {port_type::sas, "sas"},
+  {port_type::mfdp_multi_function_display_port, "mfdp_multi_function_display_port"},
+  {port_type::thunderbolt, "thunderbolt"},
+  {port_type::compatible_8251, "compatible_8251"},
+  {port_type::compatible_8251_fifo, "compatible_8251_fifo"},
+  {port_type::other, "other"},
+};
+
+std::string_view smbios_name(port_type value) {
+  return find_name(port_type_names, value);
+}
+
+constexpr enum_name<memory_array_location> memory_array_location_names[] = {
+  {memory_array_location::other, "other"},
+  {memory_array_location::unknown, "unknown"},
+  {memory_array_location::system_board_or_motherboard, "system_board_or_motherboard"},
+  {memory_array_location::isa_addon_card, "isa_addon_card"},
+  {memory_array_location::eisa_addon_card, "eisa_addon_card"},
+  {memory_array_location::pci_addon_card, "pci_addon_card"},
+  {memory_array_location::mca_addon_card, "mca_addon_card"},
+  {memory_array_location::pcmcia_addon_card, "pcmcia_addon_card"},
+  {memory_array_location::proprietary_addon_card, "proprietary_addon_card"},
+  {memory_array_location::nubus_addon_card, "nubus_addon_card"},
+  {memory_array_location::pc98_c20_addon_card, "pc98_c20_addon_card"},
+  {memory_array_location::pc98_c24_addon_card, "pc98_c24_addon_card"},
+  {memory_array_location::pc98_e_addon_card, "pc98_e_addon_card"},
+  {memory_array_location::pc98_local_addon_card, "pc98_local_addon_card"},
+  {memory_array_location::cxl_addon_card, "cxl_addon_card"},
+};
+
+std::string_view smbios_name(memory_array_location value) {
+  return find_name(memory_array_location_names, value);
+}
+
+constexpr enum_name<memory_array_use> memory_array_use_names[] = {
+  {memory_array_use::other, "other"},
+  {memory_array_use::unknown, "unknown"},
+  {memory_array_use::system_memory, "system_memory"},
+  {memory_array_use::video_memory, "video_memory"},
+  {memory_array_use::flash_memory, "flash_memory"},
+  {memory_array_use::non_volatile_ram, "non_volatile_ram"},
+  {memory_array_use::cache_memory, "cache_memory"},
+};
+
+std::string_view smbios_name(memory_array_use value) {
+  return find_name(memory_array_use_names, value);
+}
+
+constexpr enum_name<memory_array_error_correction> memory_array_error_correction_names[] = {
+  {memory_array_error_correction::other, "other"},
+  {memory_array_error_correction::unknown, "unknown"},
+  {memory_array_error_correction::none, "none"},
+  {memory_array_error_correction::parity, "parity"},
+  {memory_array_error_correction::single_bit_ecc, "single_bit_ecc"},
+  {memory_array_error_correction::multi_bit_ecc, "multi_bit_ecc"},
+  {memory_array_error_correction::crc, "crc"},
+};
+
+std::string_view smbios_name(memory_array_error_correction value) {
+  return find_name(memory_array_error_correction_names, value);
+}
+
+constexpr enum_name<memory_error_type> memory_error_type_names[] = {
+  {memory_error_type::other, "other"},
+  {memory_error_type::unknown, "unknown"},
+  {memory_error_type::ok, "ok"},
+  {memory_error_type::bad_read, "bad_read"},
+  {memory_error_type::parity_err, "parity_err"},
+  {memory_error_type::single_bit_err, "single_bit_err"},
+  {memory_error_type::double_bit_err, "double_bit_err"},
+  {memory_error_type::multi_bit_err, "multi_bit_err"},
+  {memory_error_type::nibble_err, "nibble_err"},
+  {memory_error_type::checksum_err, "checksum_err"},
+  {memory_error_type::crc_err, "crc_err"},
+  {memory_error_type::corrected_single_bit_err, "corrected_single_bit_err"},
+  {memory_error_type::corrected_err, "corrected_err"},
+  {memory_error_type::uncorrectable_err, "uncorrectable_err"},
+};
+
+std::string_view smbios_name(memory_error_type value) {
+  return find_name(memory_error_type_names, value);
+}
+
+constexpr enum_name<memory_error_granularity> memory_error_granularity_names[] = {
+  {memory_error_granularity::other, "other"},
+  {memory_error_granularity::unknown, "unknown"},
+  {memory_error_granularity::device_level, "device_level"},
+  {memory_error_granularity::memory_partition_level, "memory_partition_level"},
+};
+
+std::string_view smbios_name(memory_error_granularity value) {
+  return find_name(memory_error_granularity_names, value);
+}
+
+constexpr enum_name<memory_error_operation> memory_error_operation_names[] = {
+  {memory_error_operation::other, "other"},
+  {memory_error_operation::unknown, "unknown"},
+  {memory_error_operation::read, "read"},
+  {memory_error_operation::write, "write"},
+  {memory_error_operation::partial_write, "partial_write"},
+};
+
+std::string_view smbios_name(memory_error_operation value) {
+  return find_name(memory_error_operation_names, value);
+}
+
+constexpr enum_name<memory_device_form_factor> memory_device_form_factor_names[] = {
+  {memory_device_form_factor::other, "other"},
+  {memory_device_form_factor::unknown, "unknown"},
+  {memory_device_form_factor::simm, "simm"},
+  {memory_device_form_factor::sip, "sip"},
+  {memory_device_form_factor::chip, "chip"},
+  {memory_device_form_factor::dip, "dip"},
+  {memory_device_form_factor::zip, "zip"},
+  {memory_device_form_factor::proprietary_card, "proprietary_card"},
+  {memory_device_form_factor::dimm, "dimm"},
+  {memory_device_form_factor::tsop, "tsop"},
+  {memory_device_form_factor::row_of_chips, "row_of_chips"},
+  {memory_device_form_factor::rimm, "rimm"},
+  {memory_device_form_factor::sodimm, "sodimm"},
+  {memory_device_form_factor::srimm, "srimm"},
+  {memory_device_form_factor::fb_dimm, "fb_dimm"},
+  {memory_device_form_factor::die, "die"},
+};
+
+std::string_view smbios_name(memory_device_form_factor value) {
+  return find_name(memory_device_form_factor_names, value);
+}
+
+constexpr enum_name<memory_device_type> memory_device_type_names[] = {
+  {memory_device_type::other, "other"},
+  {memory_device_type::unknown, "unknown"},
+  {memory_device_type::dram, "dram"},
+  {memory_device_type::edram, "edram"},
+  {memory_device_type::vram, "vram"},
+  {memory_device_type::sram, "sram"},
+  {memory_device_type::ram, "ram"},
+  {memory_device_type::rom, "rom"},
+  {memory_device_type::flash, "flash"},
+  {memory_device_type::eeprom, "eeprom"},
+  {memory_device_type::feprom, "feprom"},
+  {memory_device_type::eprom, "eprom"},
+  {memory_device_type::cdram, "cdram"},
+  {memory_device_type::dram3d, "dram3d"},
+  {memory_device_type::sdram, "sdram"},
+  {memory_device_type::sgram, "sgram"},
+  {memory_device_type::rdram, "rdram"},
+  {memory_device_type::ddr, "ddr"},
+  {memory_device_type::ddr2, "ddr2"},
+  {memory_device_type::ddr2_fb_dimm, "ddr2_fb_dimm"},
+  {memory_device_type::reserved, "reserved"},
+  {memory_device_type::ddr3, "ddr3"},
+  {memory_device_type::fbd2, "fbd2"},
+  {memory_device_type::ddr4, "ddr4"},
+  {memory_device_type::lpddr, "lpddr"},
+  {memory_device_type::lpddr2, "lpddr2"},
+  {memory_device_type::lpddr3, "lpddr3"},
+  {memory_device_type::lpddr4, "lpddr4"},
+  {memory_device_type::logical, "logical"},
+  {memory_device_type::hbm, "hbm"},
+  {memory_device_type::hbm2, "hbm2"},
+  {memory_device_type::ddr5, "ddr5"},
+  {memory_device_type::lpddr5, "lpddr5"},
+};
+
+std::string_view smbios_name(memory_device_type value) {
+  return find_name(memory_device_type_names, value);
+}
+
+constexpr enum_name<memory_device_type_detail> memory_device_type_detail_names[] = {
+  {memory_device_type_detail::other, "other"},
+  {memory_device_type_detail::unknown, "unknown"},
+  {memory_device_type_detail::fast_paged, "fast_paged"},
+  {memory_device_type_detail::static_column, "static_column"},
+  {memory_device_type_detail::pseudo_static, "pseudo_static"},
+  {memory_device_type_detail::rambus, "rambus"},
+  {memory_device_type_detail::synchronous, "synchronous"},
+  {memory_device_type_detail::cmos, "cmos"},
+  {memory_device_type_detail::edo, "edo"},
+  {memory_device_type_detail::window_dram, "window_dram"},
+  {memory_device_type_detail::cache_dram, "cache_dram"},
+  {memory_device_type_detail::non_volatile, "non_volatile"},
+  {memory_device_type_detail::registered, "registered"},
+  {memory_device_type_detail::unbuffered, "unbuffered"},
+  {memory_device_type_detail::lrdimm, "lrdimm"},
+};
+
+std::string_view smbios_name(memory_device_type_detail value) {
+  return find_name(memory_device_type_detail_names, value);
+}
+
+constexpr enum_name<memory_technology> memory_technology_names[] = {
+  {memory_technology::other, "other"},
+  {memory_technology::unknown, "unknown"},
+  {memory_technology::dram, "dram"},
+  {memory_technology::nvdimm_n, "nvdimm_n"},
+  {memory_technology::nvdimm_f, "nvdimm_f"},
+  {memory_technology::nvdimm_p, "nvdimm_p"},
+  {memory_technology::intel_optane, "intel_optane"},
+  {memory_technology::mrdimm, "mrdimm"},
+};
+
+std::string_view smbios_name(memory_technology value) {
+  return find_name(memory_technology_names, value);
+}
+
+constexpr enum_name<memory_operating_mode_capability> memory_operating_mode_capability_names[] = {
+  {memory_operating_mode_capability::other, "other"},
+  {memory_operating_mode_capability::unknown, "unknown"},
+  {memory_operating_mode_capability::volatile_memory, "volatile_memory"},
+  {memory_operating_mode_capability::byte_accessible_persistent_memory, "byte_accessible_persistent_memory"},
+  {memory_operating_mode_capability::block_accessible_persistent_memory, "block_accessible_persistent_memory"},
+};
+
+std::string_view smbios_name(memory_operating_mode_capability value) {
+  return find_name(memory_operating_mode_capability_names, value);
+}
+
+constexpr enum_name<system_slot_type> system_slot_type_names[] = {
+  {system_slot_type::other, "other"},
+  {system_slot_type::unknown, "unknown"},
+  {system_slot_type::isa, "isa"},
+  {system_slot_type::mca, "mca"},
+  {system_slot_type::eisa, "eisa"},
+  {system_slot_type::pci, "pci"},
+  {system_slot_type::pc_card_pcmcia, "pc_card_pcmcia"},
+  {system_slot_type::vl_vesa, "vl_vesa"},
+  {system_slot_type::proprietary, "proprietary"},
+  {system_slot_type::processor_card_slot, "processor_card_slot"},
+  {system_slot_type::proprietary_memory_card_slot, "proprietary_memory_card_slot"},
+  {system_slot_type::io_riser_card_slot, "io_riser_card_slot"},
+  {system_slot_type::nubus, "nubus"},
+  {system_slot_type::pci_66mhz_capable, "pci_66mhz_capable"},
+  {system_slot_type::agp, "agp"},
+  {system_slot_type::agp_2x, "agp_2x"},
+  {system_slot_type::agp_4x, "agp_4x"},
+  {system_slot_type::pci_x, "pci_x"},
+  {system_slot_type::agp_8x, "agp_8x"},
+  {system_slot_type::m2_socket_1_dp, "m2_socket_1_dp"},
+  {system_slot_type::m2_socket_1_sd, "m2_socket_1_sd"},
+  {system_slot_type::m2_socket_2, "m2_socket_2"},
+  {system_slot_type::m2_socket_3, "m2_socket_3"},
+  {system_slot_type::mxm_type_i, "mxm_type_i"},
+  {system_slot_type::mxm_type_ii, "mxm_type_ii"},
+  {system_slot_type::mxm_type_iii_standard, "mxm_type_iii_standard"},
+  {system_slot_type::mxm_type_iii_he, "mxm_type_iii_he"},
+  {system_slot_type::mxm_type_iv, "mxm_type_iv"},
+  {system_slot_type::mxm_3_0_type_a, "mxm_3_0_type_a"},
+  {system_slot_type::mxm_3_0_type_b, "mxm_3_0_type_b"},
+  {system_slot_type::pci_express_gen_2_sff_8639_u2, "pci_express_gen_2_sff_8639_u2"},
+  {system_slot_type::pci_express_gen_3_sff_8639_u2, "pci_express_gen_3_sff_8639_u2"},
+  {system_slot_type::pci_express_mini_52_pin_with_keepouts, "pci_express_mini_52_pin_with_keepouts"},
+  {system_slot_type::pci_express_mini_52_pin_without_keepouts, "pci_express_mini_52_pin_without_keepouts"},
+  {system_slot_type::pci_express_mini_76_pin, "pci_express_mini_76_pin"},
+  {system_slot_type::pci_express_gen_4_sff_8639_u2, "pci_express_gen_4_sff_8639_u2"},
+  {system_slot_type::pci_express_gen_5_sff_8639_u2, "pci_express_gen_5_sff_8639_u2"},
+  {system_slot_type::ocp_nic_3_0_sff, "ocp_nic_3_0_sff"},
+  {system_slot_type::ocp_nic_3_0_lff, "ocp_nic_3_0_lff"},
+  {system_slot_type::ocp_nic_prior_to_3_0, "ocp_nic_prior_to_3_0"},
+  {system_slot_type::cxl_flexbus_1_0, "cxl_flexbus_1_0"},
+  {system_slot_type::pc_98_c20, "pc_98_c20"},
+  {system_slot_type::pc_98_c24, "pc_98_c24"},
+  {system_slot_type::pc_98_e, "pc_98_e"},
+  {system_slot_type::pc_98_local_bus, "pc_98_local_bus"},
+  {system_slot_type::pc_98_card, "pc_98_card"},
+  {system_slot_type::pci_express, "pci_express"},
+  {system_slot_type::pci_express_x1, "pci_express_x1"},
+  {system_slot_type::pci_express_x2, "pci_express_x2"},
+  {system_slot_type::pci_express_x4, "pci_express_x4"},
+  {system_slot_type::pci_express_x8, "pci_express_x8"},
+  {system_slot_type::pci_express_x16, "pci_express_x16"},
+  {system_slot_type::pci_express_gen_2, "pci_express_gen_2"},
+  {system_slot_type::pci_express_gen_2_x1, "pci_express_gen_2_x1"},
+  {system_slot_type::pci_express_gen_2_x2, "pci_express_gen_2_x2"},
+  {system_slot_type::pci_express_gen_2_x4, "pci_express_gen_2_x4"},
+  {system_slot_type::pci_express_gen_2_x8, "pci_express_gen_2_x8"},
+  {system_slot_type::pci_express_gen_2_x16, "pci_express_gen_2_x16"},
+  {system_slot_type::pci_express_gen_3, "pci_express_gen_3"},
+  {system_slot_type::pci_express_gen_3_x1, "pci_express_gen_3_x1"},
+  {system_slot_type::pci_express_gen_3_x2, "pci_express_gen_3_x2"},
+  {system_slot_type::pci_express_gen_3_x4, "pci_express_gen_3_x4"},
+  {system_slot_type::pci_express_gen_3_x8, "pci_express_gen_3_x8"},
+  {system_slot_type::pci_express_gen_3_x16, "pci_express_gen_3_x16"},
+  {system_slot_type::pci_express_gen_4, "pci_express_gen_4"},
+  {system_slot_type::pci_express_gen_4_x1, "pci_express_gen_4_x1"},
+  {system_slot_type::pci_express_gen_4_x2, "pci_express_gen_4_x2"},
+  {system_slot_type::pci_express_gen_4_x4, "pci_express_gen_4_x4"},
+  {system_slot_type::pci_express_gen_4_x8, "pci_express_gen_4_x8"},
+  {system_slot_type::pci_express_gen_4_x16, "pci_express_gen_4_x16"},
+  {system_slot_type::pci_express_gen_5, "pci_express_gen_5"},
+  {system_slot_type::pci_express_gen_5_x1, "pci_express_gen_5_x1"},
+  {system_slot_type::pci_express_gen_5_x2, "pci_express_gen_5_x2"},
+  {system_slot_type::pci_express_gen_5_x4, "pci_express_gen_5_x4"},
+  {system_slot_type::pci_express_gen_5_x8, "pci_express_gen_5_x8"},
+  {system_slot_type::pci_express_gen_5_x16, "pci_express_gen_5_x16"},
+  {system_slot_type::pci_express_gen_6_and_beyond, "pci_express_gen_6_and_beyond"},
+  {system_slot_type::enterprise_edsff_e1, "enterprise_edsff_e1"},
+  {system_slot_type::enterprise_edsff_e3, "enterprise_edsff_e3"},
+};
+
+std::string_view smbios_name(system_slot_type value) {
+  return find_name(system_slot_type_names, value);
+}
+
+constexpr enum_name<system_slot_width> system_slot_width_names[] = {
+  {system_slot_width::other, "other"},
+  {system_slot_width::unknown, "unknown"},
+  {system_slot_width::eight_bit, "eight_bit"},
+  {system_slot_width::sixteen_bit, "sixteen_bit"},
+  {system_slot_width::thirty_two_bit, "thirty_two_bit"},
+  {system_slot_width::sixty_four_bit, "sixty_four_bit"},
+  {system_slot_width::reserved, "reserved"},
+  {system_slot_width::one_x, "one_x"},
+  {system_slot_width::two_x, "two_x"},
+  {system_slot_width::four_x, "four_x"},
+  {system_slot_width::eight_x, "eight_x"},
+  {system_slot_width::sixteen_x, "sixteen_x"},
+  {system_slot_width::thirty_two_x, "thirty_two_x"},
+};
+
+std::string_view smbios_name(system_slot_width value) {
+  return find_name(system_slot_width_names, value);
+}
+
+constexpr enum_name<system_slot_current_usage> system_slot_current_usage_names[] = {
+  {system_slot_current_usage::other, "other"},
+  {system_slot_current_usage::unknown, "unknown"},
+  {system_slot_current_usage::available, "available"},
+  {system_slot_current_usage::in_use, "in_use"},
+  {system_slot_current_usage::unavailable, "unavailable"},
+};
+
+std::string_view smbios_name(system_slot_current_usage value) {
+  return find_name(system_slot_current_usage_names, value);
+}
+
+constexpr enum_name<system_slot_length> system_slot_length_names[] = {
+  {system_slot_length::other, "other"},
+  {system_slot_length::unknown, "unknown"},
+  {system_slot_length::short_length, "short_length"},
+  {system_slot_length::long_length, "long_length"},
+  {system_slot_length::drive_2_5_form_factor, "drive_2_5_form_factor"},
+  {system_slot_length::drive_3_5_form_factor, "drive_3_5_form_factor"},
+};
+
+std::string_view smbios_name(system_slot_length value) {
+  return find_name(system_slot_length_names, value);
+}
+
+constexpr enum_name<slot_characteristics1> slot_characteristics1_names[] = {
+  {slot_characteristics1::characteristics_unknown, "characteristics_unknown"},
+  {slot_characteristics1::provides_5v, "provides_5v"},
+  {slot_characteristics1::provides_3_3v, "provides_3_3v"},
+  {slot_characteristics1::shared_slot, "shared_slot"},
+  {slot_characteristics1::pc_support_card16, "pc_support_card16"},
+  {slot_characteristics1::pc_support_cardbus, "pc_support_cardbus"},
+  {slot_characteristics1::pc_support_zoom_video, "pc_support_zoom_video"},
+  {slot_characteristics1::pc_support_modem_ring_resume, "pc_support_modem_ring_resume"},
+};
+
+std::string_view smbios_name(slot_characteristics1 value) {
+  return find_name(slot_characteristics1_names, value);
+}
+
+constexpr enum_name<slot_characteristics2> slot_characteristics2_names[] = {
+  {slot_characteristics2::pci_slot_support_pme, "pci_slot_support_pme"},
+  {slot_characteristics2::slot_support_hot_plug, "slot_support_hot_plug"},
+  {slot_characteristics2::pci_slot_support_smbus, "pci_slot_support_smbus"},
+};
+
+std::string_view smbios_name(slot_characteristics2 value) {
+  return find_name(slot_characteristics2_names, value);
+}
+
+constexpr enum_name<device_status> device_status_names[] = {
+  {device_status::disabled, "disabled"},
+  {device_status::enabled, "enabled"},
+};
+
+std::string_view smbios_name(device_status value) {
+  return find_name(device_status_names, value);
+}
+
+constexpr enum_name<device_type> device_type_names[] = {
+  {device_type::other, "other"},
+  {device_type::unknown, "unknown"},
+  {device_type::video, "video"},
+  {device_type::scsi_controller, "scsi_controller"},
+  {device_type::ethernet, "ethernet"},
+  {device_type::token_ring, "token_ring"},
+  {device_type::sound, "sound"},
+  {device_type::pata_controller, "pata_controller"},
+  {device_type::sata_controller, "sata_controller"},
+  {device_type::sas_controller, "sas_controller"},
+  {device_type::wireless_lan, "wireless_lan"},
+  {device_type::bluetooth, "bluetooth"},
+  {device_type::wwan, "wwan"},
+  {device_type::emmc, "emmc"},
+  {device_type::nvme, "nvme"},
+};
+
+std::string_view smbios_name(device_type value) {
+  return find_name(device_type_names, value);
+}
+
+constexpr enum_name<firmware_inventory_characteristics> firmware_inventory_characteristics_names[] = {
+  {firmware_inventory_characteristics::updatable, "updatable"},
+  {firmware_inventory_characteristics::write_protected, "write_protected"},
+};
+
+std::string_view smbios_name(firmware_inventory_characteristics value) {
+  return find_name(firmware_inventory_characteristics_names, value);
+}
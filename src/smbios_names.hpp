@@ -0,0 +1,151 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_NAMES_HPP
+#define SMBIOS_SMBIOS_NAMES_HPP
+
+#include <string_view>
+
+#include "smbios.hpp"
+
+// Enumerator names as spelled in smbios.hpp. Each returns the name of
+// `value`, empty when no enumerator has that value. Flag enums name their
+// single-bit enumerators only, a combined value has no name.
+
+std::string_view smbios_name(smbios_type value);
+
+std::string_view smbios_name(bios_characteristics value);
+
+std::string_view smbios_name(bios_char_ext_byte1 value);
+
+std::string_view smbios_name(bios_char_ext_byte2 value);
+
+std::string_view smbios_name(wake_up_type value);
+
+std::string_view smbios_name(feature_flag value);
+
+std::string_view smbios_name(board_type value);
+
+std::string_view smbios_name(chassis_type value);
+
+std::string_view smbios_name(system_enclosure_state value);
+
+std::string_view smbios_name(security_status value);
+
+std::string_view smbios_name(processor_upgrade value);
+
+std::string_view smbios_name(processor_type value);
+
+std::string_view smbios_name(processor_family value);
+
+std::string_view smbios_name(processor_characteristics value);
+
+std::string_view smbios_name(cpu_status_enum value);
+
+std::string_view smbios_name(cpu_socket value);
+
+std::string_view smbios_name(cache_level value);
+
+std::string_view smbios_name(cache_socket value);
+
+std::string_view smbios_name(cache_location value);
+
+std::string_view smbios_name(cache_state value);
+
+std::string_view smbios_name(cache_operational_mode value);
+
+std::string_view smbios_name(cache_granularity value);
+
+std::string_view smbios_name(sram_type value);
+
+std::string_view smbios_name(error_correction_type value);
+
+std::string_view smbios_name(system_cache_type value);
+
+std::string_view smbios_name(associativity value);
+
+std::string_view smbios_name(connector_type value);
+
+std::string_view smbios_name(port_type value);
+
+std::string_view smbios_name(memory_array_location value);
+
+std::string_view smbios_name(memory_array_use value);
+
+std::string_view smbios_name(memory_array_error_correction value);
+
+std::string_view smbios_name(memory_error_type value);
+
+std::string_view smbios_name(memory_error_granularity value);
+
+std::string_view smbios_name(memory_error_operation value);
+
+std::string_view smbios_name(memory_device_form_factor value);
+
+std::string_view smbios_name(memory_device_type value);
+
+std::string_view smbios_name(memory_device_type_detail value);
+
+std::string_view smbios_name(memory_technology value);
+
+std::string_view smbios_name(memory_operating_mode_capability value);
+
+std::string_view smbios_name(system_slot_type value);
+
+std::string_view smbios_name(system_slot_width value);
+
+std::string_view smbios_name(system_slot_current_usage value);
+
+std::string_view smbios_name(system_slot_length value);
+
+std::string_view smbios_name(slot_characteristics1 value);
+
+std::string_view smbios_name(slot_characteristics2 value);
+
+std::string_view smbios_name(device_status value);
+
+std::string_view smbios_name(device_type value);
+
+std::string_view smbios_name(firmware_inventory_characteristics value);
+
+// Enums whose enumerators are bits OR-ed into one field, so a value is named
+// bit by bit.
+template<typename E>
+constexpr bool smbios_flag_enum = false;
+
+template<>
+inline constexpr bool smbios_flag_enum<bios_characteristics> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<bios_char_ext_byte1> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<bios_char_ext_byte2> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<feature_flag> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<processor_characteristics> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<sram_type> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<memory_device_type_detail> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<memory_operating_mode_capability> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<slot_characteristics1> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<slot_characteristics2> = true;
+
+template<>
+inline constexpr bool smbios_flag_enum<firmware_inventory_characteristics> = true;
+
+
+#endif //SMBIOS_SMBIOS_NAMES_HPP
@@ -3,183 +3,433 @@
 //
 
 #include "smbios_parser.hpp"
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <filesystem>
-#include <fstream>
-#ifdef WIN32
-#include <windows.h>
-#endif
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "smbios_fields.hpp"
+#include "smbios_format.hpp"
+
+smbios_parser::smbios_parser(std::pmr::memory_resource* resource) :
+  structures(resource),
+  storage(resource),
+  bounds(resource),
+  decoded(resource),
+  by_type(resource),
+  handles(resource) {
+}
 
 smbios_parser::smbios_parser(smbios_parser&& other) noexcept :
-  version(other.version),
+  smbios_decode_context(other),
+  threads(other.threads),
+  lazy(other.lazy),
+  types(other.types),
+  read_entries(other.read_entries),
+  cache_path(std::move(other.cache_path)),
   entry_point(other.entry_point),
-  structures(std::move(other.structures)) {
+  structures(std::move(other.structures)),
+  table(std::move(other.table)),
+  storage(std::move(other.storage)),
+  bounds(std::move(other.bounds)),
+  decoded(std::move(other.decoded)),
+  by_type(std::move(other.by_type)),
+  type_offsets(std::exchange(other.type_offsets, {})),
+  handles(std::move(other.handles)) {
+  other.entry_point = nullptr;
 }
 
-smbios_parser& smbios_parser::operator=(smbios_parser&& other) noexcept {
+smbios_parser& smbios_parser::operator=(smbios_parser&& other) {
   if (this != &other) {
     version = other.version;
-    entry_point = other.entry_point;
-    structures = std::move(other.structures);
+    threads = other.threads;
+    lazy = other.lazy;
+    types = other.types;
+    read_entries = other.read_entries;
+    cache_path = std::move(other.cache_path);
+    delete entry_point;
+    entry_point = std::exchange(other.entry_point, nullptr);
+    table = std::move(other.table);
+    bounds = std::move(other.bounds);
+    decoded = std::move(other.decoded);
+    if (resource() == other.resource()) {
+      storage = std::move(other.storage);
+    } else {
+      // std::variant is not allocator-aware, a moved structure would keep
+      // pointing into other's resource. Decoded again from the table instead.
+      try {
+        redecode_storage();
+      } catch (...) {
+        clear();
+        other.clear();
+        throw;
+      }
+    }
+    build_indexes();
     other.version = 0;
-    other.entry_point = nullptr;
-    other.structures.clear();
+    other.storage.clear();
+    other.bounds.clear();
+    other.decoded.clear();
+    other.build_indexes();
   }
   return *this;
 }
 
-constexpr uint32_t make_fourcc(std::string_view s) {
-  return s.size() == 4
-           ? (static_cast<uint32_t>(s[0]) << 24) |
-           (static_cast<uint32_t>(s[1]) << 16) |
-           (static_cast<uint32_t>(s[2]) << 8) |
-           static_cast<uint32_t>(s[3])
-           : 0;
+using structure_decoder = void (*)(smbios_variant& slot, bios_reader& reader, smbios_parser* parser);
+
+template<typename T>
+void decode_structure(smbios_variant& slot, bios_reader& reader, smbios_parser* parser) {
+  smbios_read(slot.emplace<T>(parser->resource()), reader, parser);
 }
 
-void smbios_parser::parse() {
-  std::vector<uint8_t> buffer;
+// Placeholder of the structure's class holding only its header, what a lazy
+// parse stores until the structure is accessed.
+template<typename T>
+void index_structure(smbios_variant& slot, bios_reader& reader, smbios_parser* parser) {
+  slot.emplace<T>(parser->resource()).header.read(reader);
+}
 
-#ifdef WIN32
-  uint32_t size = GetSystemFirmwareTable(make_fourcc("RSMB"), 0, nullptr, 0);
-  buffer.resize(size, 0);
-  GetSystemFirmwareTable(make_fourcc("RSMB"), 0, buffer.data(), size);
-
-  bios_streambuf istream(buffer.data(), buffer.data() + buffer.size());
-
-  auto entry_point64 = new smbios_entry_point64{};
-  entry_point = entry_point64;
-  istream.sbumpc();
-  entry_point64->smbios_major_version = istream.sbumpc();
-  entry_point64->smbios_minor_version = istream.sbumpc();
-  entry_point64->entry_point_revision = istream.sbumpc();
-  entry_point64->structure_table_max_size = istream.read_uint32();
-  version = entry_point64->smbios_major_version << 8 | entry_point64->smbios_minor_version;
-#else
-  std::ifstream entry_file("/sys/firmware/dmi/tables/smbios_entry_point", std::ios_base::binary);
-  if (entry_file) {
-    auto size = std::filesystem::file_size("/sys/firmware/dmi/tables/smbios_entry_point");
-    std::vector<uint8_t> entry_buf(size);
-    entry_file.read(reinterpret_cast<char*>(entry_buf.data()), static_cast<std::streamsize>(size));
-    if (std::string(entry_buf.data(), entry_buf.data() + 4) == "_SM_") {
-      bios_streambuf streambuf(entry_buf.data(), entry_buf.data() + entry_buf.size());
-      auto entry_point32 = new smbios_entry_point32{};
-      entry_point32->read_params(streambuf, nullptr);
-      entry_point = entry_point32;
-      version = entry_point32->smbios_major_version << 8 | entry_point32->smbios_minor_version;
-    } else if (std::string(entry_buf.data(), entry_buf.data() + 5) == "_SM3_") {
-      bios_streambuf streambuf(entry_buf.data(), entry_buf.data() + entry_buf.size());
-      auto entry_point64 = new smbios_entry_point64{};
-      entry_point64->read_params(streambuf, nullptr);
-      entry_point = entry_point64;
-      version = entry_point64->smbios_major_version << 8 | entry_point64->smbios_minor_version;
+// Sets a member smbios_fields lists back to its default, keeping the
+// allocator of strings and vectors.
+struct member_reset {
+  template<typename M>
+  void operator()(const char*, M& member) const {
+    if constexpr (std::is_array_v<M>) {
+      std::ranges::fill(member, std::remove_extent_t<M>{});
+    } else if constexpr (requires { member.clear(); }) {
+      member.clear();
+    } else {
+      member = M{};
     }
-    entry_file.close();
-  } else {
-    throw std::runtime_error("can not open /sys/firmware/dmi/tables/smbios_entry_point");
   }
+};
 
-  std::fstream file("/sys/firmware/dmi/tables/DMI", std::ios_base::in | std::ios_base::binary);
-  if (file) {
-    auto size = std::filesystem::file_size("/sys/firmware/dmi/tables/DMI");
-    buffer.resize(size);
-    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
-    file.close();
-  } else {
-    throw std::runtime_error("can not open /sys/firmware/dmi/tables/DMI\n");
+// Decodes the rest of a placeholder in place. Its header stays untouched, as
+// other threads may be reading it through structures.
+template<typename T>
+void fill_structure(smbios_variant& slot, bios_reader& reader, smbios_parser* parser) {
+  auto& s = std::get<T>(slot);
+  smbios_structure structure(reader);
+  auto formatted = structure.formatted_reader();
+  try {
+    s.T::read_params(formatted, parser);
+  } catch (...) {
+    // Back to an empty placeholder member by member, the next access retries.
+    smbios_fields(s, member_reset{});
+    throw;
+  }
+}
+
+struct structure_ops {
+  structure_decoder decode;
+  structure_decoder index;
+  structure_decoder fill;
+};
+
+template<typename... Ts>
+constexpr auto make_structure_decoders(smbios_type_list<Ts...>) {
+  std::array<structure_ops, 256> decoders{};
+  decoders.fill({&decode_structure<unknown_struct>, &index_structure<unknown_struct>, &fill_structure<unknown_struct>});
+  ((decoders[static_cast<uint8_t>(Ts::TYPE)] = {&decode_structure<Ts>, &index_structure<Ts>, &fill_structure<Ts>}), ...);
+  return decoders;
+}
+
+template<typename... Ts>
+constexpr bool has_unique_types(smbios_type_list<Ts...>) {
+  std::array<smbios_type, sizeof...(Ts)> types{Ts::TYPE...};
+  for (std::size_t i = 0; i < types.size(); ++i) {
+    for (std::size_t j = i + 1; j < types.size(); ++j) {
+      if (types[i] == types[j]) {
+        return false;
+      }
+    }
   }
+  return true;
+}
 
-  bios_streambuf istream(buffer.data(), buffer.data() + buffer.size());
+static_assert(has_unique_types(smbios_types{}), "two decoders share the same TYPE");
+
+// Indexed by the structure type byte, types without a decoder map to unknown_struct.
+constexpr auto structure_decoders = make_structure_decoders(smbios_types{});
+
+void smbios_parser::parse() {
+#ifdef WIN32
+  firmware_table_source source;
+#else
+  sysfs_entries_source entries(types);
+  if (read_entries && std::filesystem::is_directory(entries.directory)) {
+    parse(entries);
+    return;
+  }
+  sysfs_source source;
 #endif
+  parse(source);
+}
 
-  if (version > static_cast<int32_t>(smbios_version::smbios_3_5)) {
-    version = static_cast<int32_t>(smbios_version::smbios_3_5);
+void smbios_parser::parse(smbios_source& source) {
+  clear();
+  table_buffer entry_buf;
+  source.load(entry_buf, table);
+  if (!cache_path.empty() && restore_cache(entry_buf.bytes())) {
+    return;
+  }
+  decode(entry_buf.bytes());
+  if (!cache_path.empty()) {
+    write_cache(entry_buf.bytes());
   }
+}
+
+void smbios_parser::parse(std::span<const uint8_t> entry_point, std::span<const uint8_t> table) {
+  memory_source source(entry_point, table);
+  parse(source);
+}
 
-  while (istream.pos() < istream.size()) {
-    const auto type = static_cast<smbios_type>(istream.sgetc());
-    smbios* s = nullptr;
-    if (type == bios_info::TYPE) {
-      s = new bios_info{};
-    } else if (type == system_info::TYPE) {
-      s = new system_info{};
-    } else if (type == baseboard_info::TYPE) {
-      s = new baseboard_info{};
-    } else if (type == system_enclosure::TYPE) {
-      s = new system_enclosure{};
-    } else if (type == processor_info::TYPE) {
-      s = new processor_info{};
-    } else if (type == cache_info::TYPE) {
-      s = new cache_info{};
-    } else if (type == port_connector_info::TYPE) {
-      s = new port_connector_info{};
-    } else if (type == oem_strings::TYPE) {
-      s = new oem_strings{};
-    } else if (type == system_configuration_options::TYPE) {
-      s = new system_configuration_options{};
-    } else if (type == physical_memory_array::TYPE) {
-      s = new physical_memory_array{};
-    } else if (type == system_boot_info::TYPE) {
-      s = new system_boot_info{};
-    } else if (type == tpm_device::TYPE) {
-      s = new tpm_device{};
-    } else if (type == memory_error_info::TYPE) {
-      s = new memory_error_info{};
-    } else if (type == memory_array_mapped_address::TYPE) {
-      s = new memory_array_mapped_address{};
-    } else if (type == memory_device::TYPE) {
-      s = new memory_device{};
-    } else if (type == processor_additional_info::TYPE) {
-      s = new processor_additional_info{};
-    } else if (type == memory_device_mapped_address::TYPE) {
-      s = new memory_device_mapped_address{};
-    } else if (type == additional_info::TYPE) {
-      s = new additional_info{};
-    } else if (type == system_slots::TYPE) {
-      s = new system_slots{};
-    } else if (type == onboard_devices_extended_info::TYPE) {
-      s = new onboard_devices_extended_info{};
-    } else if (type == firmware_inventory_info::TYPE) {
-      s = new firmware_inventory_info{};
-    } else if (type == smbios_type::end_of_table) {
-      break;
+void smbios_parser::parse_file(const std::string& path) {
+  dump_file_source source(path);
+  parse(source);
+}
+
+void smbios_parser::clear() {
+  version = 0;
+  delete entry_point;
+  entry_point = nullptr;
+  storage.clear();
+  bounds.clear();
+  decoded.clear();
+  build_indexes();
+  table.clear();
+}
+
+void smbios_parser::decode_all() {
+  for (std::size_t i = 0; i < storage.size(); ++i) {
+    materialize(i);
+  }
+}
+
+void smbios_parser::redecode_storage() {
+  auto bytes = table.bytes();
+  storage.clear();
+  storage.resize(bounds.size());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    bios_reader reader(bytes.subspan(bounds[i].offset, bounds[i].size));
+    const auto& ops = structure_decoders[static_cast<uint8_t>(bytes[bounds[i].offset])];
+    if (decoded.empty() || decoded[i]) {
+      ops.decode(storage[i], reader, this);
     } else {
-      s = new unknown_struct{};
+      ops.index(storage[i], reader, this);
     }
+  }
+}
 
-    s->read(istream, this);
-    structures.push_back(s);
+void smbios_parser::read_entry_point_bytes(std::span<const std::byte> entry_point_bytes) {
+  entry_point = read_entry_point(entry_point_bytes).release();
+  if (entry_point) {
+    version = entry_point->version();
+  }
+
+  if (version > static_cast<int32_t>(smbios_version::smbios_3_5)) {
+    version = static_cast<int32_t>(smbios_version::smbios_3_5);
   }
 }
 
-std::string smbios_parser::sys_product_name() const {
-  for (const auto& entry : structures) {
-    if (const auto info = dynamic_cast<system_info*>(entry)) {
-      return info->product_name;
+void smbios_parser::decode(std::span<const std::byte> entry_point_bytes) {
+  read_entry_point_bytes(entry_point_bytes);
+
+  // First pass records only where each structure starts, so the second can
+  // decode them independently into preallocated slots.
+  auto bytes = table.bytes();
+  std::exception_ptr scan_error;
+  try {
+    std::size_t offset = 0;
+    while (offset < bytes.size() && static_cast<smbios_type>(bytes[offset]) != smbios_type::end_of_table) {
+      auto size = smbios_structure_size(bytes.subspan(offset));
+      if (types.contains(static_cast<smbios_type>(bytes[offset]))) {
+        bounds.push_back({offset, size});
+      }
+      offset += size;
     }
+  } catch (...) {
+    scan_error = std::current_exception();
+  }
+
+  storage.resize(bounds.size());
+  std::exception_ptr failed;
+  if (lazy) {
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+      bios_reader reader(bytes.subspan(bounds[i].offset, bounds[i].size));
+      structure_decoders[static_cast<uint8_t>(bytes[bounds[i].offset])].index(storage[i], reader, this);
+    }
+    decoded.assign(storage.size(), 0);
+  } else {
+    failed = decode_slots(bytes, bounds);
+    bounds.resize(storage.size());
+  }
+  build_indexes();
+  if (failed) {
+    std::rethrow_exception(failed);
+  }
+  if (scan_error) {
+    std::rethrow_exception(scan_error);
   }
-  return {};
 }
 
-std::string smbios_parser::sys_uuid() const {
-  for (const auto& entry : structures) {
-    if (auto sys = dynamic_cast<system_info*>(entry)) {
-      std::stringstream ss;
-      ss << std::hex << std::setfill('0');
-      for (const auto& byte : sys->uuid) {
-        ss << std::setw(2) << static_cast<int>(byte);
+std::exception_ptr smbios_parser::decode_slots(std::span<const std::byte> bytes,
+                                               std::span<const structure_bounds> bounds) {
+  // Structures before the first one that fails to decode are kept, like a
+  // sequential decode that stops there.
+  std::mutex error_mutex;
+  std::atomic<std::size_t> failed_index = bounds.size();
+  std::exception_ptr error;
+  auto decode_one = [&](std::size_t i) {
+    try {
+      bios_reader reader(bytes.subspan(bounds[i].offset, bounds[i].size));
+      structure_decoders[static_cast<uint8_t>(bytes[bounds[i].offset])].decode(storage[i], reader, this);
+      return true;
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      if (i < failed_index) {
+        failed_index = i;
+        error = std::current_exception();
       }
-      return ss.str();
+      return false;
     }
+  };
+
+  std::size_t thread_count = 1;
+  if (bounds.size() >= parallel_threshold) {
+    thread_count = threads;
+    if (thread_count == 0) {
+      thread_count = resource() == std::pmr::new_delete_resource() ? std::thread::hardware_concurrency() : 1;
+    }
+    thread_count = std::clamp<std::size_t>(thread_count, 1, bounds.size() / parallel_chunk);
   }
-  return "";
+
+  if (thread_count == 1) {
+    for (std::size_t i = 0; i < bounds.size() && decode_one(i); ++i) {
+    }
+  } else {
+    std::atomic<std::size_t> next_chunk = 0;
+    auto work = [&] {
+      for (auto begin = next_chunk.fetch_add(parallel_chunk); begin < bounds.size();
+           begin = next_chunk.fetch_add(parallel_chunk)) {
+        auto end = std::min(begin + parallel_chunk, bounds.size());
+        for (auto i = begin; i < end && i < failed_index && decode_one(i); ++i) {
+        }
+      }
+    };
+    {
+      std::vector<std::jthread> workers;
+      try {
+        for (std::size_t i = 1; i < thread_count; ++i) {
+          workers.emplace_back(work);
+        }
+      } catch (const std::system_error&) {
+        // Fewer threads than asked for, the calling thread picks up the rest.
+      }
+      work();
+    }
+  }
+
+  if (error) {
+    storage.resize(failed_index);
+  }
+  return error;
 }
 
-smbios_parser::~smbios_parser() {
-  delete entry_point;
+void smbios_parser::build_indexes() {
+  structures.clear();
+  structures.reserve(storage.size());
+  for (auto& structure : storage) {
+    structures.push_back(std::visit([](auto& s) -> smbios* { return &s; }, structure));
+  }
+  type_offsets.fill(0);
   for (const auto& structure : structures) {
-    delete structure;
+    ++type_offsets[static_cast<uint8_t>(structure->header.type) + 1];
   }
-  structures.clear();
+  for (std::size_t i = 1; i < type_offsets.size(); ++i) {
+    type_offsets[i] += type_offsets[i - 1];
+  }
+  by_type.resize(structures.size());
+  auto next = type_offsets;
+  for (const auto& structure : structures) {
+    by_type[next[static_cast<uint8_t>(structure->header.type)]++] = structure;
+  }
+  handles.build(structures);
+}
+
+void smbios_parser::materialize(std::size_t index) const {
+  if (decoded.empty() || std::atomic_ref(decoded[index]).load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard lock(materialize_mutex);
+  if (decoded[index]) {
+    return;
+  }
+  bios_reader reader(table.bytes().subspan(bounds[index].offset, bounds[index].size));
+  auto type = static_cast<uint8_t>(table.bytes()[bounds[index].offset]);
+  structure_decoders[type].fill(storage[index], reader, const_cast<smbios_parser*>(this));
+  std::atomic_ref(decoded[index]).store(1, std::memory_order_release);
+}
+
+void smbios_parser::materialize(const smbios* structure) const {
+  if (decoded.empty()) {
+    return;
+  }
+  // storage is contiguous, so structures is sorted by address.
+  auto it = std::ranges::lower_bound(structures, structure, std::less<>());
+  materialize(static_cast<std::size_t>(it - structures.begin()));
+}
+
+smbios* smbios_parser::first_of_type(smbios_type type) const {
+  auto t = static_cast<uint8_t>(type);
+  if (type_offsets[t] == type_offsets[t + 1]) {
+    return nullptr;
+  }
+  auto structure = by_type[type_offsets[t]];
+  materialize(structure);
+  return structure;
+}
+
+std::span<smbios* const> smbios_parser::of_type(smbios_type type) const {
+  auto t = static_cast<uint8_t>(type);
+  auto all = std::span(by_type).subspan(type_offsets[t], type_offsets[t + 1] - type_offsets[t]);
+  for (auto structure : all) {
+    materialize(structure);
+  }
+  return all;
+}
+
+smbios* smbios_parser::by_handle(uint16_t handle) const {
+  auto structure = handles.find(handle);
+  if (structure) {
+    materialize(structure);
+  }
+  return structure;
+}
+
+std::string smbios_parser::sys_product_name() const {
+  auto sys = static_cast<const system_info*>(first_of_type(system_info::TYPE));
+  if (!sys) {
+    return {};
+  }
+  return std::string(sys->product_name);
+}
+
+std::string smbios_parser::sys_uuid() const {
+  auto sys = static_cast<const system_info*>(first_of_type(system_info::TYPE));
+  if (!sys) {
+    return "";
+  }
+  char text[uuid_chars];
+  auto result = format_uuid(text, text + uuid_chars, sys->uuid, version);
+  return {text, result.ptr};
+}
+
+smbios_parser::~smbios_parser() {
+  delete entry_point;
 }
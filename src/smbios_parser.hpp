@@ -5,18 +5,67 @@
 #ifndef SMBIOS_SMBIOS_PARSER_HPP
 #define SMBIOS_SMBIOS_PARSER_HPP
 
+#include <array>
 #include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "handle_map.hpp"
 #include "smbios.hpp"
+#include "smbios_source.hpp"
+#include "table_buffer.hpp"
 
-struct smbios_parser {
-  uint32_t version = 0;
+// Offset and size of one structure in the table, string set included.
+struct structure_bounds {
+  std::size_t offset;
+  std::size_t size;
+};
+
+struct smbios_parser : smbios_decode_context {
+  // Tables with at least this many structures are decoded on several threads.
+  static constexpr std::size_t parallel_threshold = 2048;
+  // Structures a decode thread takes at a time.
+  static constexpr std::size_t parallel_chunk = 256;
+
+  // Threads decoding large tables. 0 uses every hardware thread when the
+  // structures allocate from std::pmr::new_delete_resource() and only the
+  // calling thread otherwise. Any other resource must be thread-safe to set
+  // this above 1.
+  unsigned threads = 0;
+  // parse() only records where each structure is, its type and handle. A
+  // structure is decoded the first time find(), of_type(), by_handle() or
+  // visit() reaches it, or by decode_all().
+  bool lazy = false;
+  // Structure types parse() keeps. The others are stepped over once their
+  // boundaries are found: they get no object, no handle and no index entry.
+  smbios_type_mask types = smbios_type_mask::all();
+  // parse() of the live tables reads only the sysfs entries of `types` where
+  // Linux exports them, one file per structure. Cheaper than the whole table
+  // for one or two types, but `structures` then come in type order.
+  bool read_entries = false;
+  // File parse() keeps the decoded structures in, e.g. /run/smbios.cache.
+  // When it was written for the same entry point and table bytes the
+  // structures are restored from it without decoding, otherwise they are
+  // decoded and the file rewritten, decoding all of a lazy parse. The file is
+  // private to its owner as it holds serial numbers. Failing to write it is
+  // not an error. Empty disables the cache.
+  std::string cache_path;
   smbios_entry_point* entry_point = nullptr;
-  std::vector<smbios*> structures;
+  // Every structure in table order, pointing into the parser's storage. After
+  // a lazy parse an entry holds only its header until it has been accessed.
+  std::pmr::vector<smbios*> structures;
+  // Raw table the structures were decoded from, smbios_string views point into it.
+  table_buffer table;
 
-  smbios_parser() = default;
+  // Structures, their strings and vectors and the parser's indexes all
+  // allocate from `resource`, which must outlive the parser.
+  explicit smbios_parser(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
   smbios_parser(const smbios_parser& other) = delete;
 
@@ -24,25 +73,132 @@ struct smbios_parser {
 
   smbios_parser(smbios_parser&& other) noexcept;
 
-  smbios_parser& operator=(smbios_parser&& other) noexcept;
+  // Between parsers on different resources the structures are decoded again
+  // from the table onto this parser's resource, which can throw.
+  smbios_parser& operator=(smbios_parser&& other);
 
+  // Live tables: sysfs on Linux, GetSystemFirmwareTable on Windows.
   void parse();
 
+  // Replaces anything parsed before with the tables `source` supplies.
+  void parse(smbios_source& source);
+
+  // Raw entry point and table blobs, copied so neither has to outlive the call.
+  void parse(std::span<const uint8_t> entry_point, std::span<const uint8_t> table);
+
+  // `dmidecode --dump-bin` image.
+  void parse_file(const std::string& path);
+
+  // Drops every structure and the retained table.
+  void clear();
+
+  // Decodes whatever a lazy parse has not yet, throws the first decode error.
+  void decode_all();
+
   template<typename T> requires std::is_base_of_v<smbios, T>
-  const T* find() {
-    for (smbios* smbios : structures) {
-      if (auto a = dynamic_cast<T*>(smbios)) {
-        return a;
+  const T* find() const {
+    if constexpr (requires { T::TYPE; }) {
+      return static_cast<const T*>(first_of_type(T::TYPE));
+    } else {
+      for (smbios* smbios : structures) {
+        if (auto a = dynamic_cast<T*>(smbios)) {
+          materialize(a);
+          return a;
+        }
       }
+      return nullptr;
+    }
+  }
+
+  // Every structure of type T in table order.
+  template<typename T> requires std::is_base_of_v<smbios, T> && requires { T::TYPE; }
+  auto find_all() const {
+    return of_type(T::TYPE) | std::views::transform([](const smbios* s) -> const T& {
+      return static_cast<const T&>(*s);
+    });
+  }
+
+  // Calls f with each structure as its concrete type, in table order.
+  template<typename F>
+  void visit(F&& f) const {
+    for (std::size_t i = 0; i < storage.size(); ++i) {
+      materialize(i);
+      std::visit(f, std::as_const(storage[i]));
     }
-    return nullptr;
+  }
+
+  // Structures with the given type byte in table order, built during parse().
+  [[nodiscard]] std::span<smbios* const> of_type(smbios_type type) const;
+
+  // Structure with the given handle, or nullptr.
+  [[nodiscard]] smbios* by_handle(uint16_t handle) const;
+
+  // Follows a handle reference such as processor_info::l2_cache_handle,
+  // nullptr when nothing of type T carries that handle.
+  template<typename T> requires std::is_base_of_v<smbios, T> && requires { T::TYPE; }
+  const T* resolve(uint16_t handle) const {
+    auto s = by_handle(handle);
+    return s && s->header.type == T::TYPE ? static_cast<const T*>(s) : nullptr;
+  }
+
+  // Where each entry of `structures` lies in `table`.
+  [[nodiscard]] std::span<const structure_bounds> table_bounds() const {
+    return bounds;
+  }
+
+  [[nodiscard]] std::pmr::memory_resource* resource() const {
+    return storage.get_allocator().resource();
   }
 
   [[nodiscard]] std::string sys_product_name() const;
 
+  // system_info's UUID as format_uuid writes it, empty without system_info.
   [[nodiscard]] std::string sys_uuid() const;
 
   ~smbios_parser();
+
+private:
+  // Structures by value, contiguous and in table order. Mutable because
+  // lazily parsed ones are decoded in place on first access.
+  mutable std::pmr::vector<smbios_variant> storage;
+  // Where each structure of storage lies in the table.
+  std::pmr::vector<structure_bounds> bounds;
+  // Per structure of a lazy parse, non-zero once decoded. Empty after a full
+  // parse. Written under materialize_mutex, read through std::atomic_ref.
+  mutable std::pmr::vector<uint8_t> decoded;
+  mutable std::mutex materialize_mutex;
+  // structures grouped by type, type t occupies [type_offsets[t], type_offsets[t + 1]).
+  std::pmr::vector<smbios*> by_type;
+  std::array<uint32_t, 257> type_offsets{};
+  handle_map handles;
+
+  void decode(std::span<const std::byte> entry_point_bytes);
+
+  // Sets entry_point and version from the raw entry point.
+  void read_entry_point_bytes(std::span<const std::byte> entry_point_bytes);
+
+  // Defined in smbios_cache.cpp. Restores the structures from cache_path,
+  // false when it is missing, damaged or written for other tables.
+  bool restore_cache(std::span<const std::byte> entry_point_bytes);
+
+  void write_cache(std::span<const std::byte> entry_point_bytes);
+
+  // Decodes every bounded structure into its slot of storage, returns the
+  // error of the first one that failed after dropping it and all later ones.
+  std::exception_ptr decode_slots(std::span<const std::byte> bytes, std::span<const structure_bounds> bounds);
+
+  // Rebuilds every slot of storage on resource() from the table and bounds,
+  // keeping a lazy parse's undecoded structures as placeholders.
+  void redecode_storage();
+
+  void build_indexes();
+
+  // Decodes the structure in storage[index] when a lazy parse skipped it.
+  void materialize(std::size_t index) const;
+
+  void materialize(const smbios* structure) const;
+
+  [[nodiscard]] smbios* first_of_type(smbios_type type) const;
 };
 
 
@@ -0,0 +1,47 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_snapshot.hpp"
+#include <mutex>
+#include <utility>
+
+static std::once_flag snapshot_once;
+// Guards only the pointer copy. libstdc++'s std::atomic<std::shared_ptr> is a
+// spin lock as well, and its load is not ordered before a later store.
+static std::mutex snapshot_mutex;
+static std::shared_ptr<const smbios_snapshot> current_snapshot;
+
+smbios_snapshot::smbios_snapshot(smbios_parser parser) : parser(std::move(parser)) {
+}
+
+static smbios_parser parse_live() {
+  smbios_parser parser;
+  parser.parse();
+  return parser;
+}
+
+std::shared_ptr<const smbios_snapshot> smbios_snapshot::get() {
+  std::call_once(snapshot_once, [] {
+    std::shared_ptr<const smbios_snapshot> snapshot(new smbios_snapshot(parse_live()));
+    std::lock_guard lock(snapshot_mutex);
+    // refresh() may have got there first.
+    if (!current_snapshot) {
+      current_snapshot = std::move(snapshot);
+    }
+  });
+  std::lock_guard lock(snapshot_mutex);
+  return current_snapshot;
+}
+
+std::shared_ptr<const smbios_snapshot> smbios_snapshot::refresh() {
+  std::shared_ptr<const smbios_snapshot> snapshot(new smbios_snapshot(parse_live()));
+  // The previous snapshot is released outside the lock, it may be the last
+  // reference.
+  auto previous = snapshot;
+  {
+    std::lock_guard lock(snapshot_mutex);
+    current_snapshot.swap(previous);
+  }
+  return snapshot;
+}
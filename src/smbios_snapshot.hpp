@@ -0,0 +1,34 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_SNAPSHOT_HPP
+#define SMBIOS_SMBIOS_SNAPSHOT_HPP
+
+#include <memory>
+
+#include "smbios_parser.hpp"
+
+// The live tables parsed once per process and shared read-only between
+// threads. The parser is fully decoded, so its const lookups (find,
+// find_all, of_type, by_handle, resolve, visit) take no lock and are safe
+// from any number of threads.
+class smbios_snapshot {
+  explicit smbios_snapshot(smbios_parser parser);
+
+public:
+  const smbios_parser parser;
+
+  // Parses the live tables on the first call, under std::call_once, and
+  // returns the current snapshot. A failed parse throws std::runtime_error
+  // and the next call tries again.
+  static std::shared_ptr<const smbios_snapshot> get();
+
+  // Parses the live tables again and atomically replaces the snapshot get()
+  // returns. Holders of the previous one keep it until they let go. On
+  // failure the current snapshot stays and std::runtime_error is thrown.
+  static std::shared_ptr<const smbios_snapshot> refresh();
+};
+
+
+#endif //SMBIOS_SMBIOS_SNAPSHOT_HPP
@@ -0,0 +1,137 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "smbios_source.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "smbios.hpp"
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+sysfs_source::sysfs_source(std::string directory, load_strategy strategy) :
+  directory(std::move(directory)),
+  strategy(strategy) {
+}
+
+void sysfs_source::load(table_buffer& entry_point, table_buffer& table) {
+  entry_point.load((directory + "/smbios_entry_point").c_str());
+  table.load((directory + "/DMI").c_str(), strategy);
+}
+
+sysfs_entries_source::sysfs_entries_source(smbios_type_mask types) : types(types) {
+}
+
+sysfs_entries_source::sysfs_entries_source(smbios_type_mask types, std::string directory,
+                                           std::string entry_point_path) :
+  types(types),
+  directory(std::move(directory)),
+  entry_point_path(std::move(entry_point_path)) {
+}
+
+void sysfs_entries_source::load(table_buffer& entry_point, table_buffer& table) {
+  if (!std::filesystem::is_directory(directory)) {
+    throw std::runtime_error(std::format("can not open {}", directory));
+  }
+  entry_point.load(entry_point_path.c_str());
+
+  // Instances of a type are numbered from 0 in table order, the first
+  // missing one ends the type.
+  std::vector<uint8_t> bytes;
+  table_buffer entry;
+  for (int type = 0; type < 256; ++type) {
+    if (!types.contains(static_cast<smbios_type>(type)) || type == static_cast<int>(smbios_type::end_of_table)) {
+      continue;
+    }
+    for (int instance = 0;; ++instance) {
+      auto path = std::format("{}/{}-{}/raw", directory, type, instance);
+      if (!std::filesystem::exists(path)) {
+        break;
+      }
+      entry.load(path.c_str());
+      bytes.insert(bytes.end(), entry.data(), entry.data() + entry.size());
+    }
+  }
+  const uint8_t end_of_table[] = {static_cast<uint8_t>(smbios_type::end_of_table), 4, 0xFF, 0xFE, 0, 0};
+  bytes.insert(bytes.end(), std::begin(end_of_table), std::end(end_of_table));
+  table.assign(bytes);
+}
+
+dump_file_source::dump_file_source(std::string path) : path(std::move(path)) {
+}
+
+void dump_file_source::load(table_buffer& entry_point, table_buffer& table) {
+  image.load(path.c_str());
+  auto header = read_entry_point(image.bytes());
+  if (!header) {
+    throw std::runtime_error(std::format("no SMBIOS entry point in {}", path));
+  }
+  auto offset = header->table_address();
+  if (offset > image.size()) {
+    throw std::runtime_error(std::format("structure table outside of {}", path));
+  }
+  auto length = static_cast<std::size_t>(std::min<uint64_t>(header->table_length(), image.size() - offset));
+  entry_point.assign(std::span(image.data(), static_cast<std::size_t>(offset)));
+  table.assign(std::span(image.data() + offset, length));
+}
+
+memory_source::memory_source(std::span<const uint8_t> entry_point, std::span<const uint8_t> table) :
+  entry_point_bytes(entry_point),
+  table_bytes(table) {
+}
+
+void memory_source::load(table_buffer& entry_point, table_buffer& table) {
+  entry_point.assign(entry_point_bytes);
+  table.assign(table_bytes);
+}
+
+#ifdef WIN32
+
+constexpr uint32_t make_fourcc(std::string_view s) {
+  return s.size() == 4
+           ? (static_cast<uint32_t>(s[0]) << 24) |
+           (static_cast<uint32_t>(s[1]) << 16) |
+           (static_cast<uint32_t>(s[2]) << 8) |
+           static_cast<uint32_t>(s[3])
+           : 0;
+}
+
+void firmware_table_source::load(table_buffer& entry_point, table_buffer& table) {
+  uint32_t size = GetSystemFirmwareTable(make_fourcc("RSMB"), 0, nullptr, 0);
+  std::vector<uint8_t> buffer(size, 0);
+  if (size == 0 || GetSystemFirmwareTable(make_fourcc("RSMB"), 0, buffer.data(), size) != size) {
+    throw std::runtime_error("can not read RSMB firmware table");
+  }
+
+  // RawSMBIOSData: Used20CallingMethod, major, minor, DMI revision, length.
+  constexpr std::size_t raw_header_size = 8;
+  if (size < raw_header_size) {
+    throw std::runtime_error("truncated RSMB firmware table");
+  }
+  auto length = static_cast<uint32_t>(size - raw_header_size);
+  std::vector<uint8_t> anchor{
+    '_', 'S', 'M', '3', '_', 0, 0x18, buffer[1], buffer[2], 0, buffer[3], 0,
+    static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8),
+    static_cast<uint8_t>(length >> 16), static_cast<uint8_t>(length >> 24),
+    0, 0, 0, 0, 0, 0, 0, 0,
+  };
+  uint8_t sum = 0;
+  for (auto byte : anchor) {
+    sum += byte;
+  }
+  anchor[5] = static_cast<uint8_t>(-sum);
+
+  entry_point = table_buffer(std::move(anchor));
+  buffer.erase(buffer.begin(), buffer.begin() + raw_header_size);
+  table = table_buffer(std::move(buffer));
+}
+
+#endif
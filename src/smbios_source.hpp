@@ -0,0 +1,87 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_SMBIOS_SOURCE_HPP
+#define SMBIOS_SMBIOS_SOURCE_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "smbios.hpp"
+#include "table_buffer.hpp"
+
+// Supplies the raw entry point and structure table to smbios_parser::parse.
+struct smbios_source {
+  // Replaces both buffers, throws std::runtime_error when the tables can not
+  // be read.
+  virtual void load(table_buffer& entry_point, table_buffer& table) = 0;
+
+  virtual ~smbios_source() = default;
+};
+
+// smbios_entry_point and DMI files as exported by Linux, `directory` can point
+// at a copy of them.
+struct sysfs_source : smbios_source {
+  std::string directory = "/sys/firmware/dmi/tables";
+  load_strategy strategy = load_strategy::read;
+
+  sysfs_source() = default;
+
+  explicit sysfs_source(std::string directory, load_strategy strategy = load_strategy::read);
+
+  void load(table_buffer& entry_point, table_buffer& table) override;
+};
+
+// Structures Linux exports one by one as `<type>-<instance>/raw` under
+// `directory`. Only the types in `types` are read, stitched into a table in
+// type then instance order, so asking for system_info costs one small read
+// instead of the whole DMI table. Meant for a few types, sysfs_source is
+// cheaper for most of the table.
+struct sysfs_entries_source : smbios_source {
+  smbios_type_mask types;
+  std::string directory = "/sys/firmware/dmi/entries";
+  // Supplies the version the structures are decoded against.
+  std::string entry_point_path = "/sys/firmware/dmi/tables/smbios_entry_point";
+
+  explicit sysfs_entries_source(smbios_type_mask types);
+
+  sysfs_entries_source(smbios_type_mask types, std::string directory, std::string entry_point_path);
+
+  void load(table_buffer& entry_point, table_buffer& table) override;
+};
+
+// Image written by `dmidecode --dump-bin`: the entry point at offset 0 with
+// its table address rewritten to the table's offset in the file. Reusing one
+// source for several paths reuses its read buffer.
+struct dump_file_source : smbios_source {
+  std::string path;
+  table_buffer image;
+
+  explicit dump_file_source(std::string path);
+
+  void load(table_buffer& entry_point, table_buffer& table) override;
+};
+
+// Blobs already in memory, e.g. shipped by a collector. Copied on load, so
+// neither span has to outlive the call.
+struct memory_source : smbios_source {
+  std::span<const uint8_t> entry_point_bytes;
+  std::span<const uint8_t> table_bytes;
+
+  memory_source(std::span<const uint8_t> entry_point, std::span<const uint8_t> table);
+
+  void load(table_buffer& entry_point, table_buffer& table) override;
+};
+
+#ifdef WIN32
+// GetSystemFirmwareTable('RSMB'), its header is presented as an SMBIOS 3.0
+// entry point.
+struct firmware_table_source : smbios_source {
+  void load(table_buffer& entry_point, table_buffer& table) override;
+};
+#endif
+
+
+#endif //SMBIOS_SMBIOS_SOURCE_HPP
@@ -0,0 +1,139 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#include "table_buffer.hpp"
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#ifdef WIN32
+#include <filesystem>
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+table_buffer::table_buffer(std::vector<uint8_t> bytes) : storage(std::move(bytes)) {
+}
+
+table_buffer::table_buffer(table_buffer&& other) noexcept :
+  storage(std::move(other.storage)),
+  mapping(std::exchange(other.mapping, nullptr)),
+  mapping_size(std::exchange(other.mapping_size, 0)) {
+}
+
+table_buffer& table_buffer::operator=(table_buffer&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    storage = std::move(other.storage);
+    mapping = std::exchange(other.mapping, nullptr);
+    mapping_size = std::exchange(other.mapping_size, 0);
+  }
+  return *this;
+}
+
+table_buffer::~table_buffer() {
+  unmap();
+}
+
+void table_buffer::unmap() {
+#ifndef WIN32
+  if (mapping) {
+    ::munmap(mapping, mapping_size);
+  }
+#endif
+  mapping = nullptr;
+  mapping_size = 0;
+}
+
+void table_buffer::clear() {
+  unmap();
+  storage.clear();
+}
+
+void table_buffer::assign(std::span<const uint8_t> bytes) {
+  unmap();
+  storage.assign(bytes.begin(), bytes.end());
+}
+
+const uint8_t* table_buffer::data() const {
+  return mapping ? static_cast<const uint8_t*>(mapping) : storage.data();
+}
+
+std::size_t table_buffer::size() const {
+  return mapping ? mapping_size : storage.size();
+}
+
+#ifdef WIN32
+
+void table_buffer::load(const char* path, load_strategy) {
+  unmap();
+  std::ifstream file(path, std::ios_base::binary);
+  if (!file) {
+    throw std::runtime_error(std::format("can not open {}", path));
+  }
+  storage.resize(std::filesystem::file_size(path));
+  file.read(reinterpret_cast<char*>(storage.data()), static_cast<std::streamsize>(storage.size()));
+  storage.resize(file.gcount());
+}
+
+#else
+
+void table_buffer::load(const char* path, load_strategy strategy) {
+  unmap();
+  int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error(std::format("can not open {}", path));
+  }
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error(std::format("can not stat {}", path));
+  }
+  auto size = static_cast<std::size_t>(st.st_size);
+
+  if (strategy == load_strategy::mmap && size > 0) {
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      ::close(fd);
+      storage.clear();
+      mapping = addr;
+      mapping_size = size;
+      return;
+    }
+  }
+
+  // sysfs reports the real size of binary attributes, other pseudo files
+  // report 0 and are read until EOF.
+  storage.resize(size > 0 ? size : 4096);
+  std::size_t total = 0;
+  while (true) {
+    if (total == storage.size()) {
+      if (size > 0) {
+        break;
+      }
+      storage.resize(storage.size() * 2);
+    }
+    auto n = ::read(fd, storage.data() + total, storage.size() - total);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      ::close(fd);
+      throw std::runtime_error(std::format("can not read {}", path));
+    }
+    if (n == 0) {
+      break;
+    }
+    total += static_cast<std::size_t>(n);
+  }
+  ::close(fd);
+  storage.resize(total);
+}
+
+#endif
@@ -0,0 +1,68 @@
+//
+// Created by Fakhr on 18/10/2026.
+//
+
+#ifndef SMBIOS_TABLE_BUFFER_HPP
+#define SMBIOS_TABLE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+enum class load_strategy {
+  // open/fstat/read into a buffer sized up front, reusing its capacity.
+  read,
+  // Private read-only mapping, falls back to read where mmap is refused
+  // (sysfs attributes, pipes, Windows).
+  mmap,
+};
+
+// Owns the raw bytes of one firmware table, either in a heap buffer or in a
+// file mapping.
+class table_buffer {
+  std::vector<uint8_t> storage;
+  void* mapping = nullptr;
+  std::size_t mapping_size = 0;
+
+  void unmap();
+
+public:
+  table_buffer() = default;
+
+  explicit table_buffer(std::vector<uint8_t> bytes);
+
+  table_buffer(const table_buffer& other) = delete;
+
+  table_buffer& operator=(const table_buffer& other) = delete;
+
+  table_buffer(table_buffer&& other) noexcept;
+
+  table_buffer& operator=(table_buffer&& other) noexcept;
+
+  ~table_buffer();
+
+  // Replaces the contents with the file at `path`, throws std::runtime_error
+  // when it can not be opened or read.
+  void load(const char* path, load_strategy strategy = load_strategy::read);
+
+  // Replaces the contents with a copy of `bytes`, reusing the buffer's capacity.
+  void assign(std::span<const uint8_t> bytes);
+
+  void clear();
+
+  [[nodiscard]] const uint8_t* data() const;
+
+  [[nodiscard]] std::size_t size() const;
+
+  [[nodiscard]] bool empty() const {
+    return size() == 0;
+  }
+
+  [[nodiscard]] std::span<const std::byte> bytes() const {
+    return std::as_bytes(std::span(data(), size()));
+  }
+};
+
+
+#endif //SMBIOS_TABLE_BUFFER_HPP